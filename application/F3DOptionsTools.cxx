@@ -74,6 +74,7 @@ static inline const std::array<CLIGroup, 8> CLIOptions = {{
       { "rendering-backend", "", "Backend to use when rendering (auto|glx|wgl|egl|osmesa)", "<string>", "" },
       { "list-rendering-backends", "", "Print the list of rendering backends available on this system", "", "" },
       { "max-size", "", "Maximum size in Mib of a file to load, leave empty for unlimited", "<size in Mib>", "" },
+      { "prefetch-budget", "", "Read the next and previous file groups in the background, up to the provided memory budget in Mib, leave empty to disable", "<size in Mib>", "" },
       { "dpi-aware", "","Scale font and window resolution according to system scale", "<bool>", "1" },
 #if F3D_MODULE_DMON
       { "watch", "", "Watch current file and automatically reload it whenever it is modified on disk", "<bool>", "1" },
@@ -86,6 +87,11 @@ static inline const std::array<CLIGroup, 8> CLIOptions = {{
     { { "verbose", "", "Set verbose level, providing more information about the loaded data in the console output", "{debug, info, warning, error, quiet}", "debug" },
       { "loading-progress", "", "Show loading progress bar", "<bool>", "1" },
       { "animation-progress", "", "Show animation progress bar", "<bool>", "1" },
+      { "geometry-cache", "", "Cache geometry read from files in the cache directory", "<bool>", "1" },
+      { "geometry-cache-budget", "", "Maximum size in Mib of the geometry cache, least recently used geometries are removed first", "<size in Mib>", "" },
+      { "texture-cache-budget", "", "Memory budget in Mib of the decoded textures shared between files", "<size in Mib>", "" },
+      { "stream-spill-directory", "", "Directory in which piped input that cannot seek is spilled instead of being kept in memory", "<directory>", "" },
+      { "stream-spill-threshold", "", "Size in Mib of piped input above which it is spilled in the spill directory", "<size in Mib>", "" },
       { "multi-file-mode", "", R"(Choose the behavior when opening multiple files. "single" will show one file at a time, "all" will show all files in a single scene, "dir" will show files from the same directory in the same scene.)", "<single|all|dir>", "" },
       { "multi-file-regex", "", R"_(Regular expression pattern to group files. Captured groups are replaced with "*" so that, for example, the pattern "part(\d+)" would group files "foo-part1.xyz" and "foo-part2.xyz" together as "foo-part*.xyz")_", "<regex>", "" },
       { "recursive-dir-add", "", "Add directories recursively", "<bool>", "1" },
@@ -150,7 +156,9 @@ static inline const std::array<CLIGroup, 8> CLIOptions = {{
       {"hdri-filename", "", "Display hdri filename", "<bool>", "1"},
       {"blur-background", "u", "Blur background", "<bool>", "1" },
       {"blur-coc", "", "Blur circle of confusion radius", "<value>", ""},
-      {"light-intensity", "", "Light intensity", "<value>", ""} } },
+      {"light-intensity", "", "Light intensity", "<value>", ""},
+      {"culling", "", "Skip the rendering of objects outside of the view", "<bool>", "1"},
+      {"culling-interaction-size", "", "Minimum size in pixels of objects rendered while interacting when using culling", "<value>", ""} } },
   {"Scientific visualization",
     { {"scalar-coloring", "s", "Color by a scalar array", "<bool>", "1" },
       {"coloring-array", "", "Name of the array to color with", "<array_name>", "" },
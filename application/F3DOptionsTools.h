@@ -36,6 +36,7 @@ static inline const OptionsDict DefaultAppOptions = {
   { "no-render", "false" },
   { "rendering-backend", "auto" },
   { "max-size", "" },
+  { "prefetch-budget", "" },
   { "animation-time", "" },
   { "watch", "false" },
   { "load-plugins", "" },
@@ -71,6 +72,11 @@ static inline const OptionsDict DefaultAppOptions = {
 static inline const std::map<std::string_view, std::string_view> LibOptionsNames = {
   { "loading-progress", "ui.loader_progress" },
   { "animation-progress", "ui.animation_progress" },
+  { "geometry-cache", "scene.geometry_cache" },
+  { "geometry-cache-budget", "scene.geometry_cache_budget" },
+  { "texture-cache-budget", "scene.texture_cache_budget" },
+  { "stream-spill-directory", "scene.stream_spill_directory" },
+  { "stream-spill-threshold", "scene.stream_spill_threshold" },
   { "up", "scene.up_direction" },
   { "axis", "ui.axis" },
   { "x-color", "ui.x_color" },
@@ -125,6 +131,8 @@ static inline const std::map<std::string_view, std::string_view> LibOptionsNames
   { "scalar-coloring", "model.scivis.enable" },
   { "coloring-array", "model.scivis.array_name" },
   { "light-intensity", "render.light.intensity" },
+  { "culling", "render.culling.enable" },
+  { "culling-interaction-size", "render.culling.interaction_size" },
   { "coloring-component", "model.scivis.component" },
   { "coloring-by-cells", "model.scivis.cells" },
   { "coloring-range", "model.scivis.range" },
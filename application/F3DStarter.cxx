@@ -41,8 +41,10 @@
 #include "window.h"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <cmath>
 #include <csignal>
 #include <filesystem>
@@ -53,6 +55,8 @@
 #include <numeric>
 #include <regex>
 #include <set>
+#include <sstream>
+#include <streambuf>
 
 #ifdef _WIN32
 #include <fcntl.h>
@@ -75,6 +79,48 @@ class F3DStarter::F3DInternals
 public:
   F3DInternals() = default;
 
+  /**
+   * Stream buffer reading the standard input and recording what was read,
+   * so that piped input can be loaded again, eg: when reloading, as it cannot be read twice
+   */
+  class StdinRecorder : public std::streambuf
+  {
+  public:
+    /**
+     * Read the rest of the standard input, then return all its recorded content
+     */
+    const std::string& GetContent()
+    {
+      while (this->underflow() != traits_type::eof())
+      {
+        this->setg(this->eback(), this->egptr(), this->egptr());
+      }
+      return this->Content;
+    }
+
+  protected:
+    int_type underflow() override
+    {
+      if (this->gptr() < this->egptr())
+      {
+        return traits_type::to_int_type(*this->gptr());
+      }
+
+      std::streamsize read = std::cin.rdbuf()->sgetn(this->Chunk.data(), this->Chunk.size());
+      if (read <= 0)
+      {
+        return traits_type::eof();
+      }
+      this->Content.append(this->Chunk.data(), static_cast<std::size_t>(read));
+      this->setg(this->Chunk.data(), this->Chunk.data(), this->Chunk.data() + read);
+      return traits_type::to_int_type(*this->gptr());
+    }
+
+  private:
+    std::array<char, 65536> Chunk;
+    std::string Content;
+  };
+
   using log_entry_t = std::tuple<std::string, std::string, std::string, std::string, std::string>;
 
   // XXX: The values in the following two structs
@@ -100,6 +146,7 @@ public:
     bool NoRender;
     std::string RenderingBackend;
     std::optional<double> MaxSize;
+    std::optional<double> PrefetchBudget;
     std::optional<double> AnimationTime;
     bool Watch;
     double FrameRate;
@@ -252,20 +299,70 @@ public:
   }
 
 #if F3D_MODULE_DMON
-  static void dmonFolderChanged(
-    dmon_watch_id, dmon_action, const char*, const char* filename, const char*, void* userData)
+  static void dmonFolderChanged(dmon_watch_id watchId, dmon_action, const char* rootDir,
+    const char* filename, const char*, void* userData)
   {
     F3DStarter* self = reinterpret_cast<F3DStarter*>(userData);
     const std::lock_guard<std::mutex> lock(self->Internals->FilesToWatchMutex);
-    if (std::find_if(self->Internals->FilesToWatch.begin(), self->Internals->FilesToWatch.end(),
-          [&](const auto& path)
-          { return path.filename() == filename; }) != self->Internals->FilesToWatch.end())
+
+    // Recover the folder as it was provided to dmon, as symbolic links are resolved in rootDir
+    fs::path folder(rootDir);
+    auto watchIt = std::find_if(self->Internals->FolderWatchIds.begin(),
+      self->Internals->FolderWatchIds.end(),
+      [&](const auto& pair) { return pair.second.id == watchId.id; });
+    if (watchIt != self->Internals->FolderWatchIds.end())
+    {
+      folder = watchIt->first;
+    }
+
+    // Compare full paths, so that files with the same name in different folders are not mixed up
+    const fs::path changedPath = (folder / filename).lexically_normal();
+    auto it = std::find_if(self->Internals->FilesToWatch.begin(),
+      self->Internals->FilesToWatch.end(),
+      [&](const auto& path) { return path.lexically_normal() == changedPath; });
+    if (it != self->Internals->FilesToWatch.end())
     {
+      // Keep track of the changed file and of the time of the change to debounce bursts of events
+      self->Internals->ChangedFiles.insert(*it);
+      self->Internals->LastFileChangeTime = std::chrono::steady_clock::now();
       self->Internals->ReloadFileRequested = true;
     }
   }
 #endif
 
+  // Reload changed files on their own when they are all already loaded
+  // Return false if a full reload of the file group is needed instead
+  bool ReloadChangedFiles(const std::set<fs::path>& changedFiles)
+  {
+    if (changedFiles.empty())
+    {
+      return false;
+    }
+    for (const fs::path& changedFile : changedFiles)
+    {
+      if (std::find(this->LoadedFiles.begin(), this->LoadedFiles.end(), changedFile) ==
+        this->LoadedFiles.end())
+      {
+        return false;
+      }
+    }
+
+    f3d::scene& scene = this->Engine->getScene();
+    try
+    {
+      for (const fs::path& changedFile : changedFiles)
+      {
+        scene.reload(changedFile);
+      }
+    }
+    catch (const f3d::scene::load_failure_exception& ex)
+    {
+      f3d::log::debug("Could not reload changed files on their own: ", ex.what());
+      return false;
+    }
+    return true;
+  }
+
   void addOutputImageMetadata(f3d::image& image)
   {
     std::stringstream cameraMetadata;
@@ -814,6 +911,7 @@ public:
     this->ParseOption(appOptions, "no-render", this->AppOptions.NoRender);
     this->ParseOption(appOptions, "rendering-backend", this->AppOptions.RenderingBackend);
     this->ParseOption(appOptions, "max-size", this->AppOptions.MaxSize);
+    this->ParseOption(appOptions, "prefetch-budget", this->AppOptions.PrefetchBudget);
     this->ParseOption(appOptions, "animation-time", this->AppOptions.AnimationTime);
     this->ParseOption(appOptions, "frame-rate", this->AppOptions.FrameRate);
     this->ParseOption(appOptions, "watch", this->AppOptions.Watch);
@@ -1011,6 +1109,39 @@ public:
     }
   }
 
+  // Prefetch the files of the next and previous file groups, in that order, when enabled
+  void PrefetchAdjacentFileGroups()
+  {
+    static constexpr int BYTES_IN_MIB = 1048576;
+    std::vector<fs::path> paths;
+    const int size = static_cast<int>(this->FilesGroups.size());
+    if (this->AppOptions.PrefetchBudget.has_value() && !this->AppOptions.NoRender && size > 1 &&
+      this->CurrentFilesGroupIndex >= 0)
+    {
+      for (int offset : { 1, -1 })
+      {
+        const std::vector<fs::path>& groupPaths =
+          this->FilesGroups[(this->CurrentFilesGroupIndex + offset + size) % size].second;
+        for (const fs::path& tmpPath : groupPaths)
+        {
+          std::error_code ec;
+          if (tmpPath == F3D_PIPED ||
+            std::find(paths.begin(), paths.end(), tmpPath) != paths.end() ||
+            (this->AppOptions.MaxSize.has_value() &&
+              fs::file_size(tmpPath, ec) >
+                static_cast<std::uintmax_t>(this->AppOptions.MaxSize.value() * BYTES_IN_MIB)))
+          {
+            continue;
+          }
+          paths.emplace_back(tmpPath);
+        }
+      }
+    }
+
+    // Providing no paths discards any previously prefetched data
+    this->Engine->getScene().prefetch(paths, this->AppOptions.PrefetchBudget.value_or(0));
+  }
+
   // Recover a set of parent paths from paths
   template<typename T>
   static std::set<fs::path> ParentPaths(const T& paths)
@@ -1046,12 +1177,21 @@ public:
   std::vector<fs::path> LoadedFiles;
   std::set<fs::path> FilesToWatch;
   int CurrentFilesGroupIndex = -1;
-  std::vector<std::byte> PipedBuffer;
+
+  // Piped input, read again from its recorded content once read,
+  // streams are kept as long as they are used by the scene
+  std::unique_ptr<StdinRecorder> PipedRecorder;
+  std::vector<std::unique_ptr<std::istream>> PipedStreams;
 
 #if F3D_MODULE_DMON
   // dmon related
   std::mutex FilesToWatchMutex;
   std::map<fs::path, dmon_watch_id> FolderWatchIds;
+  std::set<fs::path> ChangedFiles;
+  std::chrono::steady_clock::time_point LastFileChangeTime;
+
+  // Delay without any new event before reloading changed files
+  static constexpr std::chrono::milliseconds WatchDebounceDelay{ 200 };
 #endif
 
   // Event loop atomics
@@ -1573,6 +1713,8 @@ void F3DStarter::LoadFileGroup(int index, bool relativeIndex, bool forceClear)
     this->Internals->CurrentFilesGroupIndex = groupIndex;
     this->LoadFileGroupInternal(std::vector<fs::path>{}, true, "");
   }
+
+  this->Internals->PrefetchAdjacentFileGroups();
 }
 
 //----------------------------------------------------------------------------
@@ -1646,6 +1788,7 @@ void F3DStarter::LoadFileGroupInternal(
     scene.clear();
     this->Internals->LoadedFiles.clear();
     this->Internals->FilesToWatch.clear();
+    this->Internals->PipedStreams.clear();
   }
 
   if (paths.empty())
@@ -1745,40 +1888,24 @@ void F3DStarter::LoadFileGroupInternal(
         // Remove cin from path
         localPaths.erase(cinIt);
 
-        if (this->Internals->PipedBuffer.empty())
+        try
         {
-          this->Internals->PipedBuffer.clear();
-          std::size_t readLength = 1024;
-          std::size_t readSize = 0;
-
-          std::istream& is = std::cin;
-          SET_STDIN_BINARY_MODE();
-
-          // Read input stream into a buffer
+          // Add input stream to the scene, it is read while being loaded by the reader
           // this can make f3d hang until an input stream is provided
-          while (is)
+          SET_STDIN_BINARY_MODE();
+          if (!this->Internals->PipedRecorder)
           {
-            // Increase size as needed
-            this->Internals->PipedBuffer.resize(this->Internals->PipedBuffer.size() + readLength);
-
-            // Read only what is needed
-            is.read(
-              reinterpret_cast<char*>(this->Internals->PipedBuffer.data()) + readSize, readLength);
-
-            // Recover size of what was read
-            readSize += is.gcount();
-
-            // Multiple size of read by 2 and start again
-            readLength *= 2;
+            this->Internals->PipedRecorder = std::make_unique<F3DInternals::StdinRecorder>();
+            this->Internals->PipedStreams.emplace_back(
+              std::make_unique<std::istream>(this->Internals->PipedRecorder.get()));
           }
-
-          this->Internals->PipedBuffer.resize(readSize);
-        }
-
-        try
-        {
-          // Add buffer to the scene
-          scene.add(this->Internals->PipedBuffer.data(), this->Internals->PipedBuffer.size());
+          else
+          {
+            // The standard input was already read, read its recorded content again
+            this->Internals->PipedStreams.emplace_back(
+              std::make_unique<std::istringstream>(this->Internals->PipedRecorder->GetContent()));
+          }
+          scene.add(*this->Internals->PipedStreams.back());
           this->Internals->LoadedFiles.emplace_back(F3D_PIPED);
         }
         catch (const f3d::scene::load_failure_exception& ex)
@@ -2083,8 +2210,32 @@ void F3DStarter::EventLoop()
 {
   if (this->Internals->ReloadFileRequested)
   {
-    this->LoadRelativeFileGroup(0, true, true);
+    std::set<fs::path> changedFiles;
+#if F3D_MODULE_DMON
+    {
+      const std::lock_guard<std::mutex> lock(this->Internals->FilesToWatchMutex);
+
+      // Wait for the files to be stable before reloading them
+      if (std::chrono::steady_clock::now() - this->Internals->LastFileChangeTime <
+        F3DInternals::WatchDebounceDelay)
+      {
+        return;
+      }
+      changedFiles.swap(this->Internals->ChangedFiles);
+      this->Internals->ReloadFileRequested = false;
+    }
+#else
     this->Internals->ReloadFileRequested = false;
+#endif
+
+    if (this->Internals->ReloadChangedFiles(changedFiles))
+    {
+      this->Internals->Engine->getInteractor().requestRender();
+    }
+    else
+    {
+      this->LoadRelativeFileGroup(0, true, true);
+    }
   }
 }
 
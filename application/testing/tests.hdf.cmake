@@ -7,6 +7,7 @@ f3d_test(NAME TestExodusExo DATA box.exo ARGS --load-plugins=hdf NO_RENDER NO_BA
 f3d_test(NAME TestExodusG DATA box.g ARGS --load-plugins=hdf NO_RENDER NO_BASELINE REGEXP "Number of points: 24")
 f3d_test(NAME TestExodusE DATA single_timestep.e ARGS --load-plugins=hdf NO_RENDER NO_BASELINE REGEXP "Number of points: 1331")
 f3d_test(NAME TestExodusConfig DATA disk_out_ref.ex2 CONFIG ${F3D_SOURCE_DIR}/testing/configs/exodus.json ARGS -s --camera-position=-11,-2,-49)
+f3d_test(NAME TestExodusLazyArrays DATA disk_out_ref.ex2 ARGS --load-plugins=hdf -s --coloring-array=Pres --verbose NO_BASELINE REGEXP "Coloring using point array named Pres")
 f3d_test(NAME TestNetCDF DATA temperature_grid.nc ARGS --load-plugins=hdf -s)
 
 if (VTK_VERSION VERSION_GREATER_EQUAL 9.3.0)
@@ -64,8 +65,8 @@ f3d_test(NAME TestAnimationGenericImporterScalarRange DATA small.ex2 ARGS -sb --
 # Test Generic Importer Verbose animation with a single frame.
 f3d_test(NAME TestVerboseAnimationSingleTimestep DATA single_timestep.e ARGS --load-plugins=hdf --verbose NO_BASELINE REGEXP "0, 0")
 
-# Test no render animation time. Regex contains a part of the range of the VEL_ field.
-f3d_test(NAME TestNoRenderAnimation DATA small.ex2 ARGS  --load-plugins=hdf --animation-time=0.003 REGEXP "-994.473, 33.9259" NO_RENDER)
+# Test no render animation time. Regex contains a part of the range of the VEL_ field, which is only read when not reading arrays on demand.
+f3d_test(NAME TestNoRenderAnimation DATA small.ex2 ARGS  --load-plugins=hdf -DExodusII.lazy_arrays=0 --animation-time=0.003 REGEXP "-994.473, 33.9259" NO_RENDER)
 
 # Test animation time clamping
 f3d_test(NAME TestAnimationTimeLimitsHigh DATA small.ex2 ARGS ARGS --load-plugins=hdf --animation-time=10)
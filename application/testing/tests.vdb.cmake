@@ -17,6 +17,7 @@ f3d_test(NAME TestVDBDefinesDownsamplingFactor DATA icosahedron.vdb ARGS --load-
 f3d_test(NAME TestVDBDefinesInexistent DATA icosahedron.vdb ARGS --load-plugins=vdb -Dvdb.downsampling_factor=0.2 REGEXP "did you mean 'VDB.downsampling_factor'" NO_BASELINE)
 f3d_test(NAME TestVDBDefinesDownsamplingFactorParseError DATA icosahedron.vdb ARGS --load-plugins=vdb -DVDB.downsampling_factor=abcde --verbose REGEXP "Could not parse VDB.downsampling_factor" NO_BASELINE)
 f3d_test(NAME TestVDBDefinesDownsamplingFactorOutOfRangeError DATA icosahedron.vdb ARGS --load-plugins=vdb -DVDB.downsampling_factor=${_outOfRangeDoubleStr} --verbose REGEXP "VDB.downsampling_factor out of range" NO_BASELINE)
+f3d_test(NAME TestVDBDefinesMemoryBudgetParseError DATA icosahedron.vdb ARGS --load-plugins=vdb -DVDB.memory_budget=abcde --verbose REGEXP "Could not parse VDB.memory_budget" NO_BASELINE)
 f3d_test(NAME TestVDBCommandScriptReaderOptions SCRIPT DATA icosahedron.vdb ARGS --load-plugins=vdb --volume --volume-inverse) # set_reader_option VDB.downsampling_factor 0.2; reload_current_file_group
 
 if(VTK_VERSION VERSION_GREATER_EQUAL 9.5.20251210)
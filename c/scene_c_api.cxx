@@ -187,8 +187,7 @@ int f3d_scene_add_mesh(f3d_scene_t* scene, const f3d_mesh_t* mesh)
   }
 
   f3d::scene* cpp_scene = reinterpret_cast<f3d::scene*>(scene);
-  f3d::mesh_t cpp_mesh = to_cpp_mesh(mesh);
-  cpp_scene->add(cpp_mesh);
+  cpp_scene->add(to_cpp_mesh(mesh));
   return 1;
 }
 
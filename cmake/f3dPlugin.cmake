@@ -37,6 +37,7 @@ f3d_plugin_declare_reader(
   [FORMAT_DESCRIPTION    <string>]
   [SCORE                 <integer>]
   [EXCLUDE_FROM_THUMBNAILER]
+  [THREAD_SAFE]
   [CUSTOM_CODE           <file>]
   EXTENSIONS             <string>...
   MIMETYPES              <string>...)
@@ -53,6 +54,7 @@ The `NAME` argument is required. The arguments are as follows:
   * `FORMAT_DESCRIPTION`: The description of the format read by the reader.
   * `SCORE`: The score of the reader (from 0 to 100). Default value is 50.
   * `EXCLUDE_FROM_THUMBNAILER`: If specified, the reader will not be used for generating thumbnails.
+  * `THREAD_SAFE`: Flag to indicate the VTK reader can be updated concurrently with other readers, default is false.
   * `CUSTOM_CODE`: A custom code file containing the implementation of ``applyCustomReader`` function.
   * `EXTENSIONS`: (Required) The list of file extensions supported by the reader.
   * `MIMETYPES`: (Required) The list of mimetypes supported by the reader.
@@ -60,7 +62,7 @@ The `NAME` argument is required. The arguments are as follows:
 #]==]
 
 macro(f3d_plugin_declare_reader)
-  cmake_parse_arguments(F3D_READER "EXCLUDE_FROM_THUMBNAILER;SUPPORTS_STREAM" "NAME;VTK_IMPORTER;VTK_READER;FORMAT_DESCRIPTION;SCORE;CUSTOM_CODE" "EXTENSIONS;MIMETYPES;OPTIONS" ${ARGN})
+  cmake_parse_arguments(F3D_READER "EXCLUDE_FROM_THUMBNAILER;SUPPORTS_STREAM;THREAD_SAFE" "NAME;VTK_IMPORTER;VTK_READER;FORMAT_DESCRIPTION;SCORE;CUSTOM_CODE" "EXTENSIONS;MIMETYPES;OPTIONS" ${ARGN})
 
   if(F3D_READER_CUSTOM_CODE)
     set(F3D_READER_HAS_CUSTOM_CODE 1)
@@ -68,6 +70,12 @@ macro(f3d_plugin_declare_reader)
     set(F3D_READER_HAS_CUSTOM_CODE 0)
   endif()
 
+  if(F3D_READER_THREAD_SAFE)
+    set(F3D_READER_HAS_THREAD_SAFE 1)
+  else()
+    set(F3D_READER_HAS_THREAD_SAFE 0)
+  endif()
+
   if(F3D_READER_SCORE)
     set(F3D_READER_HAS_SCORE 1)
   else()
@@ -5,6 +5,8 @@
 #include <scene.h>
 #include <types.h>
 
+#include <utility>
+
 static std::vector<std::string> JavaListToStringVector(JNIEnv* env, jobject list)
 {
   std::vector<std::string> vec;
@@ -244,7 +246,7 @@ extern "C"
     f3d::mesh_t cppMesh = JavaMeshToCppMesh(env, mesh);
     try
     {
-      GetEngine(env, self)->getScene().add(cppMesh);
+      GetEngine(env, self)->getScene().add(std::move(cppMesh));
     }
     catch (const std::exception& e)
     {
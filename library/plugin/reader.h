@@ -160,6 +160,16 @@ public:
     return false;
   }
 
+  /**
+   * Return true if the geometry readers created by this reader can be updated
+   * concurrently with other readers, false otherwise.
+   * Readers relying on non thread safe libraries must not be declared thread safe.
+   */
+  virtual bool isThreadSafe() const
+  {
+    return false;
+  }
+
   /**
    * Set a reader option
    * Return true if the option was found (and set), false otherwise
@@ -189,6 +199,14 @@ public:
     return keys;
   }
 
+  /**
+   * Return all reader options and their current values
+   */
+  const std::map<std::string, std::string>& getReaderOptions() const
+  {
+    return this->ReaderOptions;
+  }
+
 protected:
   std::map<std::string, std::string> ReaderOptions;
 };
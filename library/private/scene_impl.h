@@ -35,7 +35,18 @@ public:
   scene& add(const std::vector<std::filesystem::path>& filePath) override;
   scene& add(const std::vector<std::string>& filePathStrings) override;
   scene& add(const mesh_t& mesh) override;
+  scene& add(mesh_t&& mesh) override;
+  scene& add(const mesh_view_t& mesh) override;
+  scene& updateMesh(std::size_t meshId, const mesh_t& mesh) override;
+  scene& updateMesh(std::size_t meshId, mesh_t&& mesh) override;
+  scene& updateMesh(std::size_t meshId, const mesh_view_t& mesh) override;
   scene& add(std::byte* buffer, std::size_t size) override;
+  scene& add(std::istream& stream) override;
+  std::shared_ptr<async_load> addAsync(
+    const std::vector<std::filesystem::path>& filePaths) override;
+  scene& reload(const std::filesystem::path& filePath) override;
+  scene& prefetch(
+    const std::vector<std::filesystem::path>& filePaths, double memoryBudget) override;
   scene& clear() override;
   int addLight(const light_state_t& lightState) const override;
   int getLightCount() const override;
@@ -62,7 +73,16 @@ public:
    */
   void PrintImporterDescription(log::VerboseLevel level);
 
+  /**
+   * Add into the scene the files of all asynchronous loads that have been read
+   * and forget about cancelled ones. Also discard prefetched data exceeding the memory budget.
+   * Must be called from the thread using the scene.
+   * Return true if any file was added.
+   */
+  bool ProcessAsyncLoads();
+
 private:
+  class async_load_impl;
   class internals;
   std::unique_ptr<internals> Internals;
 };
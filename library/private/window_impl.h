@@ -51,6 +51,8 @@ public:
   camera& getCamera() override;
   bool render() override;
   image renderToImage(bool noBackground = false) override;
+  window& setRenderTimingsEnabled(bool enable) override;
+  std::vector<std::pair<std::string, double>> getRenderTimings() override;
   int getWidth() const override;
   int getHeight() const override;
   window& setSize(int width, int height) override;
@@ -112,6 +114,12 @@ public:
    */
   void SetCachePath(const std::filesystem::path& cachePath);
 
+  /**
+   * Implementation only API.
+   * Get the cache path, can be empty if no cache path has been set.
+   */
+  const std::filesystem::path& GetCachePath() const;
+
   /**
    * Implementation only API.
    * Set the interactor to use when recovering bindings documentation.
@@ -8,6 +8,8 @@
 /// @cond
 #include <cstddef>
 #include <filesystem>
+#include <istream>
+#include <memory>
 #include <string>
 #include <vector>
 /// @endcond
@@ -67,6 +69,41 @@ public:
    */
   virtual scene& add(const mesh_t& mesh) = 0;
 
+  /**
+   * Add and load provided mesh into the scene, taking ownership of its buffers
+   * which are used without any copy.
+   * If it fails to load the mesh, it clears the scene and
+   * throw a load_failure_exception.
+   * On other failure, throw a load_failure_exception.
+   */
+  virtual scene& add(mesh_t&& mesh) = 0;
+
+  /**
+   * Add and load provided mesh into the scene, using its buffers without any copy.
+   * The buffers must stay valid until the `release` callback of the mesh is called.
+   * If it fails to load the mesh, it clears the scene and
+   * throw a load_failure_exception.
+   * On other failure, throw a load_failure_exception.
+   */
+  virtual scene& add(const mesh_view_t& mesh) = 0;
+
+  ///@{
+  /**
+   * Update the points, normals and texture coordinates of a mesh previously added from memory,
+   * keeping its faces and the objects used to render it, so that only the updated buffers are
+   * uploaded again.
+   * meshId is the index of the mesh among the meshes added from memory since the last `clear`,
+   * in the order they were added.
+   * Empty buffers are left unchanged, others must match the number of points of the added mesh.
+   * Faces cannot be updated, face_sides and face_indices must be empty.
+   * Buffers of a mesh_view_t are used without any copy, see `add(const mesh_view_t&)`.
+   * Throw a load_failure_exception if there is no such mesh or if the update is invalid.
+   */
+  virtual scene& updateMesh(std::size_t meshId, const mesh_t& mesh) = 0;
+  virtual scene& updateMesh(std::size_t meshId, mesh_t&& mesh) = 0;
+  virtual scene& updateMesh(std::size_t meshId, const mesh_view_t& mesh) = 0;
+  ///@}
+
   /**
    * Add and load provided buffer into the scene as it was file
    * Require the use of `scene.force_reader` to be able to pick the right reader
@@ -76,6 +113,104 @@ public:
    */
   virtual scene& add(std::byte* buffer, std::size_t size) = 0;
 
+  /**
+   * Add and load the content of provided input stream into the scene as it was a file,
+   * eg: std::cin, without reading it entirely beforehand.
+   * Require the use of `scene.force_reader` to be able to pick the right reader,
+   * which must support streams.
+   * The input stream is read while the reader reads it, from its current position.
+   * When the input stream cannot seek, eg: a pipe, its content is also buffered so the reader can
+   * seek in it, in memory or in a spill file, see `scene.stream_spill_directory`.
+   * The buffered content is released and the spill file removed when the scene is cleared.
+   * The input stream must stay valid as long as it has not been entirely read.
+   * If it fails to loads the stream, it clears the scene and
+   * throw a load_failure_exception.
+   */
+  virtual scene& add(std::istream& stream) = 0;
+
+  /**
+   * A handle on an asynchronous load started with `addAsync`.
+   * `getStatus`, `getProgress` and `cancel` can be called from any thread.
+   */
+  class async_load
+  {
+  public:
+    /**
+     * Enumeration of the states of an asynchronous load
+     */
+    enum class status : unsigned char
+    {
+      READING,   // Files are being read in a background thread
+      READ,      // Files have been read and are waiting to be added into the scene
+      LOADED,    // Files have been added into the scene
+      CANCELLED, // Load has been cancelled, the scene has not been modified
+      FAILED     // Load has failed, see the log for details
+    };
+
+    /**
+     * Get the current status of the load.
+     */
+    [[nodiscard]] virtual status getStatus() const = 0;
+
+    /**
+     * Get the reading progress, between 0 and 1.
+     */
+    [[nodiscard]] virtual double getProgress() const = 0;
+
+    /**
+     * Request the load to be cancelled.
+     * Readers supporting it stop early, the read data is then discarded.
+     * Does not do anything if the files have already been added into the scene.
+     */
+    virtual void cancel() = 0;
+
+    /**
+     * Block until the files have been read and add them into the scene.
+     * This must be called from the thread using the scene.
+     * Return the final status of the load.
+     */
+    virtual status wait() = 0;
+
+    virtual ~async_load() = default;
+  };
+
+  /**
+   * Start reading provided files in a background thread and return a handle on the load.
+   * Once read, files are added into the scene by the interactor event loop
+   * or when calling `async_load::wait`, whichever comes first.
+   * The scene, including previously added files, can be rendered while reading.
+   * Files are checked before returning and a load_failure_exception is thrown
+   * if one of them does not exist or is not supported.
+   * Scene readers, as opposed to geometry readers, cannot be read in the background
+   * and are read when the files are added into the scene.
+   * Messages logged while reading are displayed by the interactor event loop or `wait`.
+   * If the read files fail to be added into the scene, the load status is `FAILED`
+   * and the scene is left as it was before, previously added files keep rendering.
+   */
+  virtual std::shared_ptr<async_load> addAsync(
+    const std::vector<std::filesystem::path>& filePaths) = 0;
+
+  /**
+   * Read again a file previously added with `add` and replace its data in the scene,
+   * keeping the data of other files, as well as the camera, untouched.
+   * Only files read by a geometry reader can be reloaded on their own.
+   * Throw a load_failure_exception if the file has not been added, cannot be reloaded
+   * on its own, or if reading it fails, in which case the scene is cleared.
+   */
+  virtual scene& reload(const std::filesystem::path& filePath) = 0;
+
+  /**
+   * Read provided files in a background thread without adding them into the scene.
+   * A later call to `add` with one of these files reuses the read data, as long as the file,
+   * the reader and the reader options did not change in the meantime.
+   * Files are prefetched in the provided order until the memory budget, in MiB, is reached.
+   * Prefetched data that is not provided anymore, or that exceeds the budget once read,
+   * is discarded. Files that do not exist, are not supported or are read by
+   * a scene reader are ignored.
+   */
+  virtual scene& prefetch(
+    const std::vector<std::filesystem::path>& filePaths, double memoryBudget) = 0;
+
   ///@{
   /**
    * Convenience initializer list signature for add method
@@ -7,7 +7,9 @@
 /// @cond
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -331,6 +333,39 @@ struct mesh_t
   F3D_EXPORT std::pair<bool, std::string> isValid() const;
 };
 
+/**
+ * Describe a 3D surfacic mesh using buffers owned by the caller, which are not copied.
+ * Buffers are described by a pointer and a number of elements and follow the same requirements
+ * as the ones of mesh_t.
+ * Buffers must stay valid and must not be modified until `release` is called,
+ * which happens once the mesh is not used anymore, or right away if the mesh cannot be added.
+ * `release` is called exactly once and can be left empty.
+ */
+struct mesh_view_t
+{
+  template<typename T>
+  struct buffer_t
+  {
+    const T* data = nullptr;
+    std::size_t size = 0;
+  };
+
+  buffer_t<float> points;
+  buffer_t<float> normals;
+  buffer_t<float> texture_coordinates;
+  buffer_t<unsigned int> face_sides;
+  buffer_t<unsigned int> face_indices;
+
+  std::function<void()> release;
+
+  /**
+   * Check validity of the mesh.
+   * Returns a pair with the first element to true if the mesh is valid.
+   * If invalid, an error message is returned in the second element.
+   */
+  F3D_EXPORT std::pair<bool, std::string> isValid() const;
+};
+
 enum class F3D_EXPORT light_type : std::uint8_t
 {
   HEADLIGHT = 1,
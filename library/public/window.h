@@ -7,6 +7,8 @@
 
 /// @cond
 #include <string>
+#include <utility>
+#include <vector>
 /// @endcond
 
 namespace f3d
@@ -77,6 +79,24 @@ public:
    */
   [[nodiscard]] virtual image renderToImage(bool noBackground = false) = 0;
 
+  /**
+   * Enable or disable the measurement of render timings, see getRenderTimings.
+   * Render timings are also measured when the `ui.fps` option is enabled.
+   * Measuring never waits for the GPU, so it does not slow down rendering.
+   * Disabled by default.
+   */
+  virtual window& setRenderTimingsEnabled(bool enable) = 0;
+
+  /**
+   * Get the GPU render timings in milliseconds of the last measured frame whose results are
+   * available, which is usually a few frames behind the last rendered frame.
+   * The first timing is the whole frame, named "Frame", followed by the timings of the render
+   * passes used in this frame, among "Blur", "SSAO", "Depth peeling", "Splat sort", "TAA" and
+   * "Overlay". "SSAO" and "Depth peeling" include the rendering of the geometry they process.
+   * Empty if no frame has been measured yet or if GPU timers are not supported, eg: on WebAssembly.
+   */
+  [[nodiscard]] virtual std::vector<std::pair<std::string, double>> getRenderTimings() = 0;
+
   /**
    * Set the size of the window.
    */
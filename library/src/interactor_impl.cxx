@@ -540,6 +540,11 @@ public:
       return false;
     }
 
+    // HDRI can be prepared in the background while interacting
+    vtkRenderWindow* renWin = this->Window.GetRenderWindow();
+    vtkF3DRenderer* ren = vtkF3DRenderer::SafeDownCast(renWin->GetRenderers()->GetFirstRenderer());
+    ren->SetHDRIAsyncPreparation(true);
+
     // Trigger a render to ensure Window is ready to be configured
     this->Window.render();
 
@@ -577,6 +582,10 @@ public:
     this->VTKInteractor->DestroyTimer(this->EventLoopTimerId);
     this->EventLoopObserverId = -1;
     this->EventLoopTimerId = 0;
+
+    vtkRenderWindow* renWin = this->Window.GetRenderWindow();
+    vtkF3DRenderer* ren = vtkF3DRenderer::SafeDownCast(renWin->GetRenderers()->GetFirstRenderer());
+    ren->SetHDRIAsyncPreparation(false);
     return true;
   }
 
@@ -614,6 +623,12 @@ public:
       this->CommandBuffer.reset();
     }
 
+    // Add files read in the background into the scene
+    if (this->Scene.ProcessAsyncLoads())
+    {
+      this->RenderRequested = true;
+    }
+
     this->AnimationManager->SetDeltaTime(deltaTime);
     this->AnimationManager->Tick();
 
@@ -621,6 +636,12 @@ public:
     vtkF3DRenderer* ren = vtkF3DRenderer::SafeDownCast(renWin->GetRenderers()->GetFirstRenderer());
     ren->SetUIDeltaTime(deltaTime);
 
+    // Swap in the HDRI prepared in the background
+    if (ren->IsHDRIPreparationReady())
+    {
+      this->RenderRequested = true;
+    }
+
     // Determine if we need a full render or just a UI render
     // At the moment, only TAA requires a full render each frame
     bool forceRender = (this->Options.render.effect.antialiasing.enable &&
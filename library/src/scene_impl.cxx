@@ -7,14 +7,18 @@
 #include "scene.h"
 #include "window_impl.h"
 
+#include "F3DLog.h"
 #include "F3DStyle.h"
+#include "F3DTextureDecoder.h"
 #include "factory.h"
 #include "vtkF3DGenericImporter.h"
+#include "vtkF3DIStreamResourceStream.h"
 #include "vtkF3DMemoryMesh.h"
 #include "vtkF3DMetaImporter.h"
 #include "vtkF3DRenderer.h"
 
 #include <optional>
+#include <vtkAlgorithm.h>
 #include <vtkCallbackCommand.h>
 #include <vtkLightCollection.h>
 #include <vtkMemoryResourceStream.h>
@@ -22,14 +26,254 @@
 #include <vtkProgressBarWidget.h>
 #include <vtkTimerLog.h>
 #include <vtkVersion.h>
+#include <vtksys/MD5.h>
 #include <vtksys/SystemTools.hxx>
 
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
 #include <vector>
 
 namespace fs = std::filesystem;
 
 namespace f3d::detail
 {
+class scene_impl::async_load_impl : public scene::async_load
+{
+public:
+  /**
+   * Start reading the importers in a dedicated worker thread,
+   * unless startWorker is false, in which case Run must be called by another thread.
+   */
+  async_load_impl(scene_impl* scene, std::vector<fs::path> filePaths,
+    std::vector<vtkSmartPointer<vtkImporter>> importers, bool startWorker = true)
+    : Scene(scene)
+    , FilePaths(std::move(filePaths))
+    , Importers(std::move(importers))
+  {
+    if (startWorker)
+    {
+      this->Worker = std::thread(&async_load_impl::Run, this);
+    }
+  }
+
+  ~async_load_impl() override
+  {
+    this->Stop();
+  }
+
+  status getStatus() const override
+  {
+    return this->Status;
+  }
+
+  double getProgress() const override
+  {
+    return this->Progress;
+  }
+
+  void cancel() override
+  {
+    this->CancelRequested = true;
+
+    status expected = status::READ;
+    if (!this->Status.compare_exchange_strong(expected, status::CANCELLED) &&
+      expected == status::READING)
+    {
+      std::lock_guard<std::mutex> lock(this->ImportersMutex);
+      for (const vtkSmartPointer<vtkImporter>& importer : this->Importers)
+      {
+        vtkF3DGenericImporter* genericImporter = vtkF3DGenericImporter::SafeDownCast(importer);
+        if (genericImporter)
+        {
+          genericImporter->AbortInternalReader();
+        }
+      }
+    }
+  }
+
+  status wait() override;
+
+  /**
+   * Join the worker thread and add the read importers into the scene, if any.
+   * Must be called from the thread using the scene.
+   */
+  status Finish();
+
+  /**
+   * Join the worker thread and return the read importers so they can be added by the caller.
+   * Return an empty vector if the read did not succeed.
+   */
+  std::vector<vtkSmartPointer<vtkImporter>> Take()
+  {
+    this->Join();
+    F3DLog::FlushDeferred();
+
+    std::lock_guard<std::mutex> lock(this->ImportersMutex);
+    std::vector<vtkSmartPointer<vtkImporter>> importers;
+    if (this->Status == status::READ && !this->ReadFailed)
+    {
+      importers = std::move(this->Importers);
+      this->Status = status::LOADED;
+    }
+    this->Importers.clear();
+    return importers;
+  }
+
+  /**
+   * Get the memory size of the read data in kibibytes, 0 if not read yet.
+   */
+  unsigned long GetMemorySize()
+  {
+    unsigned long size = 0;
+    if (this->Status == status::READ)
+    {
+      std::lock_guard<std::mutex> lock(this->ImportersMutex);
+      for (const vtkSmartPointer<vtkImporter>& importer : this->Importers)
+      {
+        vtkF3DGenericImporter* genericImporter = vtkF3DGenericImporter::SafeDownCast(importer);
+        if (genericImporter)
+        {
+          size += genericImporter->GetOutputMemorySize();
+        }
+      }
+    }
+    return size;
+  }
+
+  /**
+   * Cancel the load, join the worker thread and detach from the scene.
+   * Loads run by another thread are only cancelled.
+   */
+  void Stop()
+  {
+    if (this->Worker.joinable())
+    {
+      this->cancel();
+      this->Worker.join();
+    }
+    else if (!this->Done)
+    {
+      this->cancel();
+    }
+    this->Scene = nullptr;
+  }
+
+  /**
+   * Read the importers, then notify the threads waiting for the read to be done.
+   * Run in the worker thread of this load, or by the thread reading prefetched files.
+   */
+  void Run()
+  {
+    this->Read();
+
+    std::lock_guard<std::mutex> lock(this->DoneMutex);
+    this->Done = true;
+    this->DoneCondition.notify_all();
+  }
+
+  /**
+   * Return true if the read is done, ie: Join would not wait.
+   */
+  bool IsDone() const
+  {
+    return this->Done;
+  }
+
+  /**
+   * Wait for the read to be done, joining the worker thread if any.
+   */
+  void Join()
+  {
+    if (this->Worker.joinable())
+    {
+      this->Worker.join();
+      return;
+    }
+
+    std::unique_lock<std::mutex> lock(this->DoneMutex);
+    this->DoneCondition.wait(lock, [this]() { return this->Done; });
+  }
+
+private:
+  struct ProgressDataStruct
+  {
+    std::atomic<double>* progress;
+    double offset;
+    double scale;
+  };
+
+  /**
+   * Read all generic importers one after the other, run in the worker thread.
+   * This does not interact with the renderer, actors are created when
+   * the importers are added into the scene.
+   * Messages are deferred and displayed by the main thread, see F3DLog::FlushDeferred.
+   */
+  void Read()
+  {
+    F3DLog::SetDeferCurrentThread(true);
+
+    std::vector<vtkF3DGenericImporter*> genericImporters;
+    for (const vtkSmartPointer<vtkImporter>& importer : this->Importers)
+    {
+      vtkF3DGenericImporter* genericImporter = vtkF3DGenericImporter::SafeDownCast(importer);
+      if (genericImporter)
+      {
+        genericImporters.emplace_back(genericImporter);
+      }
+    }
+
+    const double scale = 1.0 / std::max<size_t>(genericImporters.size(), 1);
+    for (size_t i = 0; i < genericImporters.size() && !this->CancelRequested; i++)
+    {
+      ProgressDataStruct progressData{ &this->Progress, i * scale, scale };
+      vtkNew<vtkCallbackCommand> progressCallback;
+      progressCallback->SetClientData(&progressData);
+      progressCallback->SetCallback(
+        [](vtkObject*, unsigned long, void* clientData, void* callData)
+        {
+          auto data = static_cast<ProgressDataStruct*>(clientData);
+          *data->progress = data->offset + *static_cast<double*>(callData) * data->scale;
+        });
+
+      vtkAlgorithm* reader = genericImporters[i]->GetInternalReader();
+      unsigned long observerId = reader->AddObserver(vtkCommand::ProgressEvent, progressCallback);
+      if (!genericImporters[i]->UpdateInternalReader())
+      {
+        this->ReadFailed = true;
+      }
+      reader->RemoveObserver(observerId);
+    }
+
+    this->Progress = 1.0;
+    this->Status = this->CancelRequested ? status::CANCELLED : status::READ;
+  }
+
+  scene_impl* Scene;
+  std::vector<fs::path> FilePaths;
+  std::vector<vtkSmartPointer<vtkImporter>> Importers;
+  std::mutex ImportersMutex;
+  std::thread Worker;
+
+  std::mutex DoneMutex;
+  std::condition_variable DoneCondition;
+  std::atomic<bool> Done = false;
+
+  std::atomic<status> Status = status::READING;
+  std::atomic<double> Progress = 0.0;
+  std::atomic<bool> CancelRequested = false;
+  std::atomic<bool> ReadFailed = false;
+};
+
+//----------------------------------------------------------------------------
 class scene_impl::internals
 {
 public:
@@ -41,8 +285,108 @@ public:
     this->MetaImporter->SetRenderWindow(this->Window.GetRenderWindow());
     this->Window.SetImporter(this->MetaImporter);
     this->AnimationManager.SetImporter(this->MetaImporter);
+
+    // Textures are decoded on worker threads for the lifetime of the engine
+    F3DTextureDecoder::StartWorkers();
+  }
+
+  ~internals()
+  {
+    for (const std::shared_ptr<scene_impl::async_load_impl>& asyncLoad : this->AsyncLoads)
+    {
+      asyncLoad->Stop();
+    }
+    for (const PrefetchEntry& entry : this->PrefetchEntries)
+    {
+      entry.Load->Stop();
+    }
+    this->Prefetcher.Stop();
+    F3DLog::FlushDeferred();
+
+    // Decoded textures are shared between scenes, release them with the engine
+    F3DTextureDecoder::StopWorkers();
+    F3DTextureDecoder::ClearCache();
   }
 
+  /**
+   * A single background thread reading prefetched files one after the other,
+   * so that non thread safe readers never read concurrently.
+   * Queued loads are owned by the worker until read, discarded loads are then released.
+   */
+  class PrefetchWorker
+  {
+  public:
+    ~PrefetchWorker()
+    {
+      this->Stop();
+    }
+
+    /**
+     * Queue a load to be read once the previously queued ones have been read
+     */
+    void Push(const std::shared_ptr<scene_impl::async_load_impl>& load)
+    {
+      {
+        std::lock_guard<std::mutex> lock(this->Mutex);
+        this->Queue.emplace_back(load);
+        if (!this->Thread.joinable())
+        {
+          this->Thread = std::thread(&PrefetchWorker::Loop, this);
+        }
+      }
+      this->Condition.notify_one();
+    }
+
+    /**
+     * Cancel all queued loads and join the worker thread
+     */
+    void Stop()
+    {
+      {
+        std::lock_guard<std::mutex> lock(this->Mutex);
+        this->StopRequested = true;
+      }
+      this->Condition.notify_one();
+      if (this->Thread.joinable())
+      {
+        this->Thread.join();
+      }
+    }
+
+  private:
+    void Loop()
+    {
+      while (true)
+      {
+        std::shared_ptr<scene_impl::async_load_impl> load;
+        {
+          std::unique_lock<std::mutex> lock(this->Mutex);
+          this->Condition.wait(
+            lock, [this]() { return this->StopRequested || !this->Queue.empty(); });
+          if (this->Queue.empty())
+          {
+            return;
+          }
+          load = std::move(this->Queue.front());
+          this->Queue.pop_front();
+          if (this->StopRequested)
+          {
+            load->cancel();
+          }
+        }
+
+        // Cancelled loads do not read anything but still notify waiting threads
+        load->Run();
+      }
+    }
+
+    std::mutex Mutex;
+    std::condition_variable Condition;
+    std::deque<std::shared_ptr<scene_impl::async_load_impl>> Queue;
+    std::thread Thread;
+    bool StopRequested = false;
+  };
+
   struct ProgressDataStruct
   {
     vtkTimerLog* timer;
@@ -90,7 +434,7 @@ public:
     data->timer->StartTimer();
   }
 
-  void Load(const std::vector<vtkSmartPointer<vtkImporter>>& importers)
+  void Load(const std::vector<vtkSmartPointer<vtkImporter>>& importers, bool clearOnFailure = true)
   {
     for (const vtkSmartPointer<vtkImporter>& importer : importers)
     {
@@ -111,6 +455,51 @@ public:
       this->MetaImporter->SetCameraIndex(this->Options.scene.camera.index.value());
     }
 
+    this->UpdateMetaImporter(true, clearOnFailure);
+    this->EnforceGeometryCacheBudget(importers);
+  }
+
+  /**
+   * Add importers into the scene like Load, but if they fail to load, remove them and restore
+   * the previous scene instead of clearing it, then throw a load_failure_exception
+   */
+  void LoadOrRestore(const std::vector<vtkSmartPointer<vtkImporter>>& importers)
+  {
+    try
+    {
+      this->Load(importers, false);
+    }
+    catch (const scene::load_failure_exception&)
+    {
+      for (const vtkSmartPointer<vtkImporter>& importer : importers)
+      {
+        this->MetaImporter->RemoveImporter(importer);
+      }
+
+      // Remaining importers are already imported, this only restores the scene state
+      this->UpdateMetaImporter(false);
+      throw;
+    }
+  }
+
+  /**
+   * Replace the importer of a previously added file by a new one and update the scene,
+   * keeping the importers of other files as is and not touching the camera
+   */
+  void Reload(vtkImporter* previous, const vtkSmartPointer<vtkImporter>& importer)
+  {
+    this->MetaImporter->ReplaceImporter(previous, importer);
+    this->UpdateMetaImporter(false);
+    this->EnforceGeometryCacheBudget({ importer });
+  }
+
+  /**
+   * Update the meta importer, which only updates importers that have not been updated before,
+   * then update the animation and the window accordingly.
+   * Throw a load_failure_exception on failure, after clearing the scene if requested.
+   */
+  void UpdateMetaImporter(bool resetCamera, bool clearOnFailure = true)
+  {
     // Manage progress bar
     vtkNew<vtkProgressBarWidget> progressWidget;
     vtkNew<vtkTimerLog> timer;
@@ -140,8 +529,13 @@ public:
       this->MetaImporter->RemoveObservers(vtkCommand::ProgressEvent);
       progressWidget->Off();
 
-      this->MetaImporter->Clear();
-      this->Window.Initialize();
+      if (clearOnFailure)
+      {
+        this->MetaImporter->Clear();
+        this->ImportersByPath.clear();
+        this->MemoryMeshImporters.clear();
+        this->Window.Initialize();
+      }
       throw scene::load_failure_exception("failed to load scene");
     }
 #else
@@ -158,7 +552,7 @@ public:
 
     // Update all window options and reset camera to bounds if needed
     this->Window.UpdateDynamicOptions();
-    if (!this->Options.scene.camera.index.has_value())
+    if (resetCamera && !this->Options.scene.camera.index.has_value())
     {
       this->Window.getCamera().resetToBounds();
     }
@@ -166,6 +560,408 @@ public:
     scene_impl::internals::DisplayAllInfo(this->MetaImporter, this->Window);
   }
 
+  /**
+   * Create an importer for each provided file path, empty paths are ignored.
+   * Throw a load_failure_exception if a file does not exist or is not supported.
+   */
+  std::vector<vtkSmartPointer<vtkImporter>> CreateImporters(const std::vector<fs::path>& filePaths)
+  {
+    F3DTextureDecoder::SetCacheBudget(this->Options.scene.texture_cache_budget);
+
+    std::vector<vtkSmartPointer<vtkImporter>> importers;
+    for (const fs::path& filePath : filePaths)
+    {
+      if (filePath.empty())
+      {
+        log::debug("An empty file to load was provided\n");
+        continue;
+      }
+
+      if (!vtksys::SystemTools::FileExists(filePath.string(), true))
+      {
+        throw scene::load_failure_exception(filePath.string() + " does not exists");
+      }
+      std::optional<std::string> forceReader = this->Options.scene.force_reader;
+      // Recover the importer for the provided file path
+      const f3d::reader* reader =
+        f3d::factory::instance()->getReader(filePath.string(), forceReader);
+      if (reader)
+      {
+        if (forceReader)
+        {
+          log::debug("Forcing reader ", (*forceReader), " for ", filePath.string());
+        }
+        else
+        {
+          log::debug(
+            "Found a reader for \"", filePath.string(), "\" : \"", reader->getName(), "\"");
+        }
+      }
+      else
+      {
+        if (forceReader)
+        {
+          throw scene::load_failure_exception(*forceReader + " is not a valid force reader");
+        }
+        throw scene::load_failure_exception(
+          filePath.string() + " is not a file of a supported 3D scene file format");
+      }
+
+      vtkSmartPointer<vtkImporter> importer = this->TakePrefetchedImporter(filePath, reader);
+      if (!importer)
+      {
+        importer = reader->createSceneReader(filePath.string());
+      }
+      if (!importer)
+      {
+        importer = this->CreateGenericImporter(filePath, reader);
+      }
+      importers.emplace_back(importer);
+    }
+    return importers;
+  }
+
+  /**
+   * Keep track of the importer used for each provided file path, empty paths are ignored
+   * as they are by CreateImporters
+   */
+  void RecordImporters(const std::vector<fs::path>& filePaths,
+    const std::vector<vtkSmartPointer<vtkImporter>>& importers)
+  {
+    auto importerIt = importers.begin();
+    for (const fs::path& filePath : filePaths)
+    {
+      if (!filePath.empty() && importerIt != importers.end())
+      {
+        this->ImportersByPath[filePath] = *importerIt++;
+      }
+    }
+  }
+
+  /**
+   * Create an importer reading the provided stream using the forced reader.
+   * Throw a load_failure_exception if there is no valid forced reader supporting streams.
+   */
+  vtkSmartPointer<vtkImporter> CreateStreamImporter(
+    vtkResourceStream* stream, const std::string& action)
+  {
+    std::optional<std::string> forceReader = this->Options.scene.force_reader;
+    if (!forceReader)
+    {
+      throw scene::load_failure_exception("No force reader set while trying to " + action);
+    }
+
+    // Recover the forced reader
+    const f3d::reader* reader = f3d::factory::instance()->getReader("", forceReader);
+    if (reader)
+    {
+      log::debug("Using forced reader ", (*forceReader), " for stream");
+    }
+    else
+    {
+      throw scene::load_failure_exception(*forceReader + " is not a valid force reader");
+    }
+
+    vtkSmartPointer<vtkImporter> importer = reader->createSceneReader(stream);
+    if (!importer)
+    {
+      auto vtkReader = reader->createGeometryReader(stream);
+
+      if (!vtkReader)
+      {
+        throw scene::load_failure_exception(*forceReader + " does not support reading streams");
+      }
+
+      vtkNew<vtkF3DGenericImporter> genericImporter;
+      genericImporter->SetInternalReader(vtkReader);
+      genericImporter->SetThreadSafeReader(reader->isThreadSafe());
+      importer = genericImporter;
+    }
+    return importer;
+  }
+
+  /**
+   * Create a generic importer using the geometry reader of the provided reader
+   */
+  vtkSmartPointer<vtkF3DGenericImporter> CreateGenericImporter(
+    const fs::path& filePath, const f3d::reader* reader)
+  {
+    // XXX: F3D Plugin CMake logic ensure there is either a scene reader or a geometry reader
+    auto vtkReader = reader->createGeometryReader(filePath.string());
+    assert(vtkReader);
+    vtkSmartPointer<vtkF3DGenericImporter> genericImporter =
+      vtkSmartPointer<vtkF3DGenericImporter>::New();
+    genericImporter->SetInternalReader(vtkReader);
+    genericImporter->SetThreadSafeReader(reader->isThreadSafe());
+
+    const fs::path& cachePath = this->Window.GetCachePath();
+    if (this->Options.scene.geometry_cache && !cachePath.empty())
+    {
+      std::string key = internals::ComputeGeometryCacheKey(filePath, reader);
+      log::debug("Using geometry cache key ", key, " for ", filePath.string());
+      const fs::path entryPath = cachePath / "geometry" / key;
+      genericImporter->SetCacheDirectory(entryPath.string());
+
+      // Mark the entry as recently used, it is not there yet if the file was never cached
+      std::error_code ec;
+      fs::last_write_time(entryPath, fs::file_time_type::clock::now(), ec);
+    }
+    return genericImporter;
+  }
+
+  /**
+   * Remove the least recently used geometry cache entries until the size of the cache is below
+   * the budget, when the provided importers wrote new entries. Only the new entries add to the
+   * size of the cache, so it is not scanned when all outputs were read from the cache.
+   */
+  void EnforceGeometryCacheBudget(const std::vector<vtkSmartPointer<vtkImporter>>& importers)
+  {
+    std::set<fs::path> writtenEntries;
+    for (const vtkSmartPointer<vtkImporter>& importer : importers)
+    {
+      vtkF3DGenericImporter* genericImporter = vtkF3DGenericImporter::SafeDownCast(importer);
+      if (genericImporter && genericImporter->GetCacheWritten())
+      {
+        writtenEntries.emplace(genericImporter->GetCacheDirectory());
+      }
+    }
+    if (writtenEntries.empty())
+    {
+      return;
+    }
+
+    static constexpr double BYTES_IN_MIB = 1048576;
+    const std::uintmax_t maxSize = static_cast<std::uintmax_t>(
+      std::max(0.0, this->Options.scene.geometry_cache_budget) * BYTES_IN_MIB);
+
+    struct CacheEntry
+    {
+      fs::path Path;
+      fs::file_time_type Time;
+      std::uintmax_t Size;
+    };
+
+    // Entries are directories, with their last use time as modification time
+    std::error_code ec;
+    std::vector<CacheEntry> entries;
+    std::uintmax_t totalSize = 0;
+    const fs::path geometryCachePath = writtenEntries.begin()->parent_path();
+    for (const fs::directory_entry& dir : fs::directory_iterator(geometryCachePath, ec))
+    {
+      CacheEntry entry{ dir.path(), dir.last_write_time(ec), 0 };
+      for (const fs::directory_entry& file : fs::recursive_directory_iterator(dir.path(), ec))
+      {
+        entry.Size += file.is_regular_file(ec) ? file.file_size(ec) : 0;
+      }
+      totalSize += entry.Size;
+
+      // Newly written entries are never removed
+      if (writtenEntries.count(dir.path()) == 0)
+      {
+        entries.emplace_back(std::move(entry));
+      }
+    }
+
+    std::sort(entries.begin(), entries.end(),
+      [](const CacheEntry& a, const CacheEntry& b) { return a.Time < b.Time; });
+    for (const CacheEntry& entry : entries)
+    {
+      if (totalSize <= maxSize)
+      {
+        break;
+      }
+      log::debug("Removing geometry cache entry ", entry.Path.string());
+      fs::remove_all(entry.Path, ec);
+      totalSize -= entry.Size;
+    }
+  }
+
+  struct PrefetchEntry
+  {
+    fs::path Path;
+    std::string Key;
+    std::uintmax_t FileSize;
+    std::shared_ptr<scene_impl::async_load_impl> Load;
+
+    /**
+     * Actual size of the read data if available, size of the file otherwise, in bytes
+     */
+    std::uintmax_t GetSize() const
+    {
+      unsigned long memorySize = this->Load->GetMemorySize();
+      return memorySize > 0 ? static_cast<std::uintmax_t>(memorySize) * 1024 : this->FileSize;
+    }
+  };
+
+  /**
+   * Recover the importer prefetched for the provided file and reader, if any.
+   * A prefetch still reading is discarded rather than waited for, so that the caller
+   * creates and reads the importer itself without waiting for the prefetch worker.
+   */
+  vtkSmartPointer<vtkImporter> TakePrefetchedImporter(
+    const fs::path& filePath, const f3d::reader* reader)
+  {
+    if (this->PrefetchEntries.empty())
+    {
+      return nullptr;
+    }
+
+    const std::string key = internals::ComputeGeometryCacheKey(filePath, reader);
+    auto it = std::find_if(this->PrefetchEntries.begin(), this->PrefetchEntries.end(),
+      [&](const PrefetchEntry& entry) { return entry.Path == filePath && entry.Key == key; });
+    if (it == this->PrefetchEntries.end())
+    {
+      return nullptr;
+    }
+
+    if (!it->Load->IsDone())
+    {
+      log::debug("Prefetch of ", filePath.string(), " is not done, reading it again");
+      internals::DiscardPrefetch(*it);
+      this->PrefetchEntries.erase(it);
+      return nullptr;
+    }
+
+    std::shared_ptr<scene_impl::async_load_impl> load = it->Load;
+    this->PrefetchEntries.erase(it);
+    std::vector<vtkSmartPointer<vtkImporter>> importers = load->Take();
+    if (importers.empty())
+    {
+      return nullptr;
+    }
+
+    log::debug("Using prefetched data for ", filePath.string());
+    return importers[0];
+  }
+
+  /**
+   * Cancel a prefetch, the prefetch worker releases it once read or skipped
+   */
+  static void DiscardPrefetch(const PrefetchEntry& entry)
+  {
+    log::debug("Discarding prefetched ", entry.Path.string());
+    entry.Load->Stop();
+  }
+
+  /**
+   * Discard prefetched data, in order, from the first one exceeding the memory budget
+   */
+  void EnforcePrefetchBudget()
+  {
+    std::uintmax_t size = 0;
+    for (auto it = this->PrefetchEntries.begin(); it != this->PrefetchEntries.end();)
+    {
+      size += it->GetSize();
+      if (size > this->PrefetchBudget)
+      {
+        this->DiscardPrefetch(*it);
+        it = this->PrefetchEntries.erase(it);
+      }
+      else
+      {
+        ++it;
+      }
+    }
+  }
+
+  /**
+   * Compute a geometry cache key from the file path, size and modification time
+   * as well as the reader name and the reader options
+   */
+  static std::string ComputeGeometryCacheKey(const fs::path& filePath, const f3d::reader* reader)
+  {
+    // Missing files are reported by the reader, not here
+    std::error_code ec;
+    std::string key = fs::absolute(filePath, ec).string();
+    key += "|" + std::to_string(fs::file_size(filePath, ec));
+    key += "|" + std::to_string(fs::last_write_time(filePath, ec).time_since_epoch().count());
+    key += "|" + reader->getName();
+    for (const auto& [name, value] : reader->getReaderOptions())
+    {
+      key += "|" + name + "=" + value;
+    }
+
+    unsigned char digest[16];
+    char md5Hash[33];
+    md5Hash[32] = '\0';
+
+    vtksysMD5* md5 = vtksysMD5_New();
+    vtksysMD5_Initialize(md5);
+    vtksysMD5_Append(
+      md5, reinterpret_cast<const unsigned char*>(key.data()), static_cast<int>(key.size()));
+    vtksysMD5_Finalize(md5, digest);
+    vtksysMD5_DigestToHex(digest, md5Hash);
+    vtksysMD5_Delete(md5);
+
+    return md5Hash;
+  }
+
+  /**
+   * Create a view on the buffers of a mesh, kept alive until the view is released
+   */
+  static mesh_view_t CreateMeshView(const std::shared_ptr<mesh_t>& mesh)
+  {
+    return { { mesh->points.data(), mesh->points.size() },
+      { mesh->normals.data(), mesh->normals.size() },
+      { mesh->texture_coordinates.data(), mesh->texture_coordinates.size() },
+      { mesh->face_sides.data(), mesh->face_sides.size() },
+      { mesh->face_indices.data(), mesh->face_indices.size() }, [mesh]() {} };
+  }
+
+  /**
+   * Create an owner of the buffers of a mesh view, which calls the release callback
+   * once the last VTK buffer wrapping them is freed
+   */
+  static std::shared_ptr<void> CreateMeshViewOwner(const mesh_view_t& mesh)
+  {
+    return std::shared_ptr<void>(nullptr,
+      [release = mesh.release](void*)
+      {
+        if (release)
+        {
+          release();
+        }
+      });
+  }
+
+  /**
+   * Check that a mesh view can be used to update a mesh with the provided number of points.
+   * If invalid, an error message is returned in the second element.
+   */
+  static std::pair<bool, std::string> IsMeshUpdateValid(const mesh_view_t& mesh, size_t nbPoints)
+  {
+    if (mesh.face_sides.size > 0 || mesh.face_indices.size > 0)
+    {
+      return { false, "Faces cannot be updated, face buffers must be empty." };
+    }
+
+    if ((mesh.points.size > 0 && !mesh.points.data) ||
+      (mesh.normals.size > 0 && !mesh.normals.data) ||
+      (mesh.texture_coordinates.size > 0 && !mesh.texture_coordinates.data))
+    {
+      return { false, "A non empty buffer must not be null." };
+    }
+
+    if (mesh.points.size > 0 && mesh.points.size != nbPoints * 3)
+    {
+      return { false, "The points buffer must be empty or equal to 3 times the number of points." };
+    }
+
+    if (mesh.normals.size > 0 && mesh.normals.size != nbPoints * 3)
+    {
+      return { false,
+        "The normals buffer must be empty or equal to 3 times the number of points." };
+    }
+
+    if (mesh.texture_coordinates.size > 0 && mesh.texture_coordinates.size != nbPoints * 2)
+    {
+      return { false,
+        "The texture_coordinates buffer must be empty or equal to 2 times the number of points." };
+    }
+
+    return { true, {} };
+  }
+
   static void DisplayImporterDescription(log::VerboseLevel level, vtkImporter* importer)
   {
     vtkIdType availCameras = importer->GetNumberOfCameras();
@@ -204,8 +1000,78 @@ public:
   animationManager AnimationManager;
 
   vtkNew<vtkF3DMetaImporter> MetaImporter;
+
+  std::vector<std::shared_ptr<scene_impl::async_load_impl>> AsyncLoads;
+
+  std::vector<PrefetchEntry> PrefetchEntries;
+  std::uintmax_t PrefetchBudget = 0;
+  PrefetchWorker Prefetcher;
+
+  std::map<fs::path, vtkSmartPointer<vtkImporter>> ImportersByPath;
+
+  // Resource streams of the input streams added to the scene, released when it is cleared
+  std::vector<vtkSmartPointer<vtkF3DIStreamResourceStream>> InputStreams;
+
+  // Importers of the meshes added from memory, indexed by mesh id
+  std::vector<vtkSmartPointer<vtkF3DGenericImporter>> MemoryMeshImporters;
 };
 
+//----------------------------------------------------------------------------
+scene::async_load::status scene_impl::async_load_impl::wait()
+{
+  if (!this->Scene)
+  {
+    return this->Status;
+  }
+
+  // Finish the load and forget about it
+  std::vector<std::shared_ptr<async_load_impl>>& asyncLoads = this->Scene->Internals->AsyncLoads;
+  auto it = std::find_if(asyncLoads.begin(), asyncLoads.end(),
+    [this](const std::shared_ptr<async_load_impl>& asyncLoad) { return asyncLoad.get() == this; });
+  status finalStatus = this->Finish();
+  if (it != asyncLoads.end())
+  {
+    asyncLoads.erase(it);
+  }
+  return finalStatus;
+}
+
+//----------------------------------------------------------------------------
+scene::async_load::status scene_impl::async_load_impl::Finish()
+{
+  this->Join();
+  F3DLog::FlushDeferred();
+
+  if (this->Status == status::READ && this->Scene)
+  {
+    if (this->ReadFailed)
+    {
+      log::error("Failed to read files asynchronously");
+      this->Status = status::FAILED;
+    }
+    else
+    {
+      try
+      {
+        this->Scene->Internals->LoadOrRestore(this->Importers);
+        this->Scene->Internals->RecordImporters(this->FilePaths, this->Importers);
+        this->Status = status::LOADED;
+      }
+      catch (const scene::load_failure_exception& ex)
+      {
+        log::error("Failed to load files asynchronously: ", ex.what());
+        this->Status = status::FAILED;
+      }
+    }
+  }
+
+  // Importers are owned by the meta importer once loaded
+  std::lock_guard<std::mutex> lock(this->ImportersMutex);
+  this->Importers.clear();
+  this->Scene = nullptr;
+  return this->Status;
+}
+
 //----------------------------------------------------------------------------
 scene_impl::scene_impl(options& options, window_impl& window)
   : Internals(std::make_unique<scene_impl::internals>(options, window))
@@ -239,56 +1105,8 @@ scene& scene_impl::add(const std::vector<fs::path>& filePaths)
     return *this;
   }
 
-  std::vector<vtkSmartPointer<vtkImporter>> importers;
-  for (const fs::path& filePath : filePaths)
-  {
-    if (filePath.empty())
-    {
-      log::debug("An empty file to load was provided\n");
-      continue;
-    }
-
-    if (!vtksys::SystemTools::FileExists(filePath.string(), true))
-    {
-      throw scene::load_failure_exception(filePath.string() + " does not exists");
-    }
-    std::optional<std::string> forceReader = this->Internals->Options.scene.force_reader;
-    // Recover the importer for the provided file path
-    const f3d::reader* reader = f3d::factory::instance()->getReader(filePath.string(), forceReader);
-    if (reader)
-    {
-      if (forceReader)
-      {
-        log::debug("Forcing reader ", (*forceReader), " for ", filePath.string());
-      }
-      else
-      {
-        log::debug("Found a reader for \"", filePath.string(), "\" : \"", reader->getName(), "\"");
-      }
-    }
-    else
-    {
-      if (forceReader)
-      {
-        throw scene::load_failure_exception(*forceReader + " is not a valid force reader");
-      }
-      throw scene::load_failure_exception(
-        filePath.string() + " is not a file of a supported 3D scene file format");
-    }
-
-    vtkSmartPointer<vtkImporter> importer = reader->createSceneReader(filePath.string());
-    if (!importer)
-    {
-      // XXX: F3D Plugin CMake logic ensure there is either a scene reader or a geometry reader
-      auto vtkReader = reader->createGeometryReader(filePath.string());
-      assert(vtkReader);
-      vtkSmartPointer<vtkF3DGenericImporter> genericImporter =
-        vtkSmartPointer<vtkF3DGenericImporter>::New();
-      genericImporter->SetInternalReader(vtkReader);
-      importer = genericImporter;
-    }
-    importers.emplace_back(importer);
-  }
+  std::vector<vtkSmartPointer<vtkImporter>> importers =
+    this->Internals->CreateImporters(filePaths);
 
   log::debug("\nLoading files: ");
   if (filePaths.size() == 1)
@@ -305,59 +1123,169 @@ scene& scene_impl::add(const std::vector<fs::path>& filePaths)
   log::debug("");
 
   this->Internals->Load(importers);
+  this->Internals->RecordImporters(filePaths, importers);
   return *this;
 }
 
 //----------------------------------------------------------------------------
-scene& scene_impl::add(std::byte* buffer, std::size_t size)
+std::shared_ptr<scene::async_load> scene_impl::addAsync(const std::vector<fs::path>& filePaths)
 {
-  if (buffer == nullptr || size == 0)
+  std::vector<vtkSmartPointer<vtkImporter>> importers =
+    this->Internals->CreateImporters(filePaths);
+
+  log::debug("\nReading files asynchronously: ");
+  for (const fs::path& filePathStr : filePaths)
   {
-    log::debug("Empty buffer or zero size when trying to load a buffer into the scene provided\n");
-    return *this;
+    log::debug("- ", filePathStr.string());
   }
+  log::debug("");
+
+  auto asyncLoad =
+    std::make_shared<scene_impl::async_load_impl>(this, filePaths, std::move(importers));
+  this->Internals->AsyncLoads.emplace_back(asyncLoad);
+  return asyncLoad;
+}
 
-  std::optional<std::string> forceReader = this->Internals->Options.scene.force_reader;
-  if (!forceReader)
+//----------------------------------------------------------------------------
+scene& scene_impl::reload(const fs::path& filePath)
+{
+  auto it = this->Internals->ImportersByPath.find(filePath);
+  if (it == this->Internals->ImportersByPath.end())
   {
-    throw scene::load_failure_exception(
-      "No force reader set while trying to load a buffer from memory");
+    throw scene::load_failure_exception(filePath.string() + " has not been added to the scene");
   }
 
-  // Recover the forced reader
-  const f3d::reader* reader = f3d::factory::instance()->getReader("", forceReader);
-  if (reader)
+  // Other importers may have created lights or cameras that cannot be removed on their own
+  vtkSmartPointer<vtkImporter> previous = it->second;
+  if (!vtkF3DGenericImporter::SafeDownCast(previous))
   {
-    log::debug("Using forced reader ", (*forceReader), " for stream");
+    throw scene::load_failure_exception(
+      filePath.string() + " is not read by a geometry reader and cannot be reloaded on its own");
   }
-  else
+
+  std::vector<vtkSmartPointer<vtkImporter>> importers =
+    this->Internals->CreateImporters({ filePath });
+  if (!vtkF3DGenericImporter::SafeDownCast(importers[0]))
   {
-    throw scene::load_failure_exception(*forceReader + " is not a valid force reader");
+    throw scene::load_failure_exception(
+      filePath.string() + " is not read by a geometry reader anymore and cannot be reloaded");
   }
 
-  vtkNew<vtkMemoryResourceStream> stream;
-  stream->SetBuffer(buffer, size);
+  log::debug("\nReloading file: ", filePath.string(), "\n");
+  this->Internals->Reload(previous, importers[0]);
+  it->second = importers[0];
+  return *this;
+}
+
+//----------------------------------------------------------------------------
+scene& scene_impl::prefetch(const std::vector<fs::path>& filePaths, double memoryBudget)
+{
+  static constexpr double BYTES_IN_MIB = 1048576;
+  this->Internals->PrefetchBudget = static_cast<std::uintmax_t>(memoryBudget * BYTES_IN_MIB);
 
-  vtkSmartPointer<vtkImporter> importer = reader->createSceneReader(stream);
-  if (!importer)
+  std::vector<internals::PrefetchEntry> entries;
+  std::uintmax_t size = 0;
+  for (const fs::path& filePath : filePaths)
   {
-    auto vtkReader = reader->createGeometryReader(stream);
+    std::error_code ec;
+    if (filePath.empty() || !fs::is_regular_file(filePath, ec))
+    {
+      continue;
+    }
 
-    if (!vtkReader)
+    f3d::reader* reader = f3d::factory::instance()->getReader(
+      filePath.string(), this->Internals->Options.scene.force_reader);
+    if (!reader || reader->hasSceneReader())
     {
-      throw scene::load_failure_exception(*forceReader + " does not support reading streams");
+      log::debug(filePath.string(), " cannot be prefetched");
+      continue;
     }
 
-    vtkNew<vtkF3DGenericImporter> genericImporter;
-    genericImporter->SetInternalReader(vtkReader);
-    importer = genericImporter;
+    // Keep data that has already been prefetched
+    std::string key = internals::ComputeGeometryCacheKey(filePath, reader);
+    std::vector<internals::PrefetchEntry>& previousEntries = this->Internals->PrefetchEntries;
+    auto it = std::find_if(previousEntries.begin(), previousEntries.end(),
+      [&](const internals::PrefetchEntry& entry)
+      { return entry.Path == filePath && entry.Key == key; });
+    if (it != previousEntries.end())
+    {
+      size += it->GetSize();
+      entries.emplace_back(std::move(*it));
+      previousEntries.erase(it);
+      continue;
+    }
+
+    std::uintmax_t fileSize = fs::file_size(filePath, ec);
+    if (size + fileSize > this->Internals->PrefetchBudget)
+    {
+      log::debug("Prefetch memory budget reached, not prefetching ", filePath.string());
+      break;
+    }
+    size += fileSize;
+
+    log::debug("Prefetching ", filePath.string());
+    std::vector<vtkSmartPointer<vtkImporter>> importers = {
+      this->Internals->CreateGenericImporter(filePath, reader)
+    };
+    auto load = std::make_shared<scene_impl::async_load_impl>(
+      nullptr, std::vector<fs::path>{ filePath }, std::move(importers), false);
+    this->Internals->Prefetcher.Push(load);
+    entries.emplace_back(internals::PrefetchEntry{ filePath, key, fileSize, load });
+  }
+
+  // Discard prefetched data that has not been requested again
+  for (const internals::PrefetchEntry& entry : this->Internals->PrefetchEntries)
+  {
+    this->Internals->DiscardPrefetch(entry);
+  }
+  this->Internals->PrefetchEntries = std::move(entries);
+  return *this;
+}
+
+//----------------------------------------------------------------------------
+scene& scene_impl::add(std::byte* buffer, std::size_t size)
+{
+  if (buffer == nullptr || size == 0)
+  {
+    log::debug("Empty buffer or zero size when trying to load a buffer into the scene provided\n");
+    return *this;
   }
 
+  vtkNew<vtkMemoryResourceStream> stream;
+  stream->SetBuffer(buffer, size);
+
+  vtkSmartPointer<vtkImporter> importer =
+    this->Internals->CreateStreamImporter(stream, "load a buffer from memory");
+
   log::debug("\nLoading stream");
   this->Internals->Load({ importer });
   return *this;
 }
 
+//----------------------------------------------------------------------------
+scene& scene_impl::add(std::istream& stream)
+{
+  // Input streams are owned by the caller and read from their current position
+  static constexpr double BYTES_IN_MIB = 1048576;
+  const options& opt = this->Internals->Options;
+  vtkNew<vtkF3DIStreamResourceStream> resourceStream;
+  if (opt.scene.stream_spill_directory.has_value())
+  {
+    resourceStream->SetSpillDirectory(opt.scene.stream_spill_directory.value().string());
+  }
+  resourceStream->SetSpillThreshold(
+    static_cast<vtkTypeInt64>(std::max(0.0, opt.scene.stream_spill_threshold) * BYTES_IN_MIB));
+  resourceStream->SetInput(&stream);
+
+  vtkSmartPointer<vtkImporter> importer =
+    this->Internals->CreateStreamImporter(resourceStream, "load an input stream");
+
+  log::debug("\nLoading input stream", resourceStream->IsBuffering() ? " buffering it" : "");
+  this->Internals->InputStreams.emplace_back(resourceStream);
+  this->Internals->Load({ importer });
+  return *this;
+}
+
 //----------------------------------------------------------------------------
 scene& scene_impl::add(const mesh_t& mesh)
 {
@@ -379,6 +1307,104 @@ scene& scene_impl::add(const mesh_t& mesh)
 
   log::debug("Loading 3D scene from memory");
   this->Internals->Load({ importer });
+  this->Internals->MemoryMeshImporters.emplace_back(importer);
+  return *this;
+}
+
+//----------------------------------------------------------------------------
+scene& scene_impl::add(mesh_t&& mesh)
+{
+  // The moved mesh is owned by the view and its vectors are used without any copy
+  return this->add(internals::CreateMeshView(std::make_shared<mesh_t>(std::move(mesh))));
+}
+
+//----------------------------------------------------------------------------
+scene& scene_impl::add(const mesh_view_t& mesh)
+{
+  std::shared_ptr<void> owner = internals::CreateMeshViewOwner(mesh);
+
+  // sanity checks
+  auto [valid, err] = mesh.isValid();
+  if (!valid)
+  {
+    throw scene::load_failure_exception(err);
+  }
+
+  vtkNew<vtkF3DMemoryMesh> vtkSource;
+  vtkSource->SetPoints(mesh.points.data, static_cast<vtkIdType>(mesh.points.size), owner);
+  vtkSource->SetNormals(mesh.normals.data, static_cast<vtkIdType>(mesh.normals.size), owner);
+  vtkSource->SetTCoords(mesh.texture_coordinates.data,
+    static_cast<vtkIdType>(mesh.texture_coordinates.size), owner);
+  vtkSource->SetFaces(mesh.face_sides.data, static_cast<vtkIdType>(mesh.face_sides.size),
+    mesh.face_indices.data, static_cast<vtkIdType>(mesh.face_indices.size), owner);
+  owner.reset();
+
+  vtkSmartPointer<vtkF3DGenericImporter> importer = vtkSmartPointer<vtkF3DGenericImporter>::New();
+  importer->SetInternalReader(vtkSource);
+
+  log::debug("Loading 3D scene from memory buffers");
+  this->Internals->Load({ importer });
+  this->Internals->MemoryMeshImporters.emplace_back(importer);
+  return *this;
+}
+
+//----------------------------------------------------------------------------
+scene& scene_impl::updateMesh(std::size_t meshId, const mesh_t& mesh)
+{
+  return this->updateMesh(meshId, mesh_t(mesh));
+}
+
+//----------------------------------------------------------------------------
+scene& scene_impl::updateMesh(std::size_t meshId, mesh_t&& mesh)
+{
+  return this->updateMesh(
+    meshId, internals::CreateMeshView(std::make_shared<mesh_t>(std::move(mesh))));
+}
+
+//----------------------------------------------------------------------------
+scene& scene_impl::updateMesh(std::size_t meshId, const mesh_view_t& mesh)
+{
+  std::shared_ptr<void> owner = internals::CreateMeshViewOwner(mesh);
+
+  if (meshId >= this->Internals->MemoryMeshImporters.size())
+  {
+    throw scene::load_failure_exception(
+      "No mesh added from memory at index " + std::to_string(meshId) + " to update");
+  }
+
+  vtkF3DGenericImporter* importer = this->Internals->MemoryMeshImporters[meshId];
+  vtkF3DMemoryMesh* vtkSource = vtkF3DMemoryMesh::SafeDownCast(importer->GetInternalReader());
+  assert(vtkSource);
+
+  // sanity checks
+  auto [valid, err] = internals::IsMeshUpdateValid(
+    mesh, static_cast<size_t>(vtkSource->GetNumberOfPoints()));
+  if (!valid)
+  {
+    throw scene::load_failure_exception(err);
+  }
+
+  // Only the provided buffers are replaced, faces are kept as is
+  if (mesh.points.size > 0)
+  {
+    vtkSource->SetPoints(mesh.points.data, static_cast<vtkIdType>(mesh.points.size), owner);
+  }
+  if (mesh.normals.size > 0)
+  {
+    vtkSource->SetNormals(mesh.normals.data, static_cast<vtkIdType>(mesh.normals.size), owner);
+  }
+  if (mesh.texture_coordinates.size > 0)
+  {
+    vtkSource->SetTCoords(mesh.texture_coordinates.data,
+      static_cast<vtkIdType>(mesh.texture_coordinates.size), owner);
+  }
+  owner.reset();
+
+  log::debug("Updating mesh ", meshId, " from memory buffers");
+  if (!this->Internals->MetaImporter->UpdateImportedData(importer))
+  {
+    throw scene::load_failure_exception("failed to update mesh " + std::to_string(meshId));
+  }
   return *this;
 }
 
@@ -387,10 +1413,22 @@ scene& scene_impl::clear()
 {
   // Clear the meta importer from all importers
   this->Internals->MetaImporter->Clear();
+  this->Internals->ImportersByPath.clear();
+  this->Internals->MemoryMeshImporters.clear();
 
   // Clear the window of all actors
   this->Internals->Window.Initialize();
 
+  // Release decoded textures, images still used by prefetched files are kept alive by them
+  F3DTextureDecoder::ClearCache();
+
+  // Release the content buffered from input streams and remove their spill files
+  for (const vtkSmartPointer<vtkF3DIStreamResourceStream>& stream : this->Internals->InputStreams)
+  {
+    stream->SetInput(nullptr);
+  }
+  this->Internals->InputStreams.clear();
+
   return *this;
 }
 
@@ -539,4 +1577,30 @@ void scene_impl::PrintImporterDescription(log::VerboseLevel level)
 {
   scene_impl::internals::DisplayImporterDescription(level, this->Internals->MetaImporter);
 }
+
+//----------------------------------------------------------------------------
+bool scene_impl::ProcessAsyncLoads()
+{
+  // Display the messages of the files being read in the background
+  F3DLog::FlushDeferred();
+
+  bool loaded = false;
+  std::vector<std::shared_ptr<async_load_impl>>& asyncLoads = this->Internals->AsyncLoads;
+  for (auto it = asyncLoads.begin(); it != asyncLoads.end();)
+  {
+    if ((*it)->getStatus() == async_load::status::READING)
+    {
+      ++it;
+      continue;
+    }
+
+    // Keep a reference as finishing may add importers into the scene
+    std::shared_ptr<async_load_impl> asyncLoad = *it;
+    it = asyncLoads.erase(it);
+    loaded |= asyncLoad->Finish() == async_load::status::LOADED;
+  }
+
+  this->Internals->EnforcePrefetchBudget();
+  return loaded;
+}
 }
@@ -8,51 +8,55 @@
 #include <numeric>
 #include <string>
 
-namespace f3d
+namespace
 {
 //----------------------------------------------------------------------------
-std::pair<bool, std::string> mesh_t::isValid() const
+std::pair<bool, std::string> IsMeshValid(const f3d::mesh_view_t& mesh)
 {
-  if (this->points.size() == 0)
+  if (mesh.points.size == 0)
   {
     return { false, "The points buffer must not be empty." };
   }
 
-  if (this->points.size() % 3 != 0)
+  if (mesh.points.size % 3 != 0)
   {
     std::string err = "The points buffer is not a multiple of 3. It's length is ";
-    err += std::to_string(this->points.size());
+    err += std::to_string(mesh.points.size);
     return { false, std::move(err) };
   }
 
-  size_t nbPoints = this->points.size() / 3;
+  size_t nbPoints = mesh.points.size / 3;
 
-  if (this->normals.size() > 0 && this->normals.size() != nbPoints * 3)
+  if (mesh.normals.size > 0 && mesh.normals.size != nbPoints * 3)
   {
     return { false, "The normals buffer must be empty or equal to 3 times the number of points." };
   }
 
-  if (this->texture_coordinates.size() > 0 && this->texture_coordinates.size() != nbPoints * 2)
+  if (mesh.texture_coordinates.size > 0 && mesh.texture_coordinates.size != nbPoints * 2)
   {
     return { false,
       "The texture_coordinates buffer must be empty or equal to 2 times the number of points." };
   }
 
-  unsigned int expectedSize = std::accumulate(this->face_sides.begin(), this->face_sides.end(), 0);
+  const unsigned int* sidesBegin = mesh.face_sides.data;
+  const unsigned int* sidesEnd = sidesBegin + mesh.face_sides.size;
+  size_t expectedSize = std::accumulate(sidesBegin, sidesEnd, size_t(0));
 
-  if (this->face_indices.size() != expectedSize)
+  if (mesh.face_indices.size != expectedSize)
   {
     std::string err = "The face_indices buffer size is invalid, it should be ";
     err += std::to_string(expectedSize);
     return { false, std::move(err) };
   }
 
-  auto it = std::find_if(this->face_indices.cbegin(), this->face_indices.cend(),
-    [=](unsigned int idx) { return idx >= nbPoints; });
-  if (it != this->face_indices.cend())
+  const unsigned int* indicesBegin = mesh.face_indices.data;
+  const unsigned int* indicesEnd = indicesBegin + mesh.face_indices.size;
+  auto it =
+    std::find_if(indicesBegin, indicesEnd, [=](unsigned int idx) { return idx >= nbPoints; });
+  if (it != indicesEnd)
   {
     std::string err = "Face vertex at index ";
-    err += std::to_string(std::distance(this->face_indices.cbegin(), it));
+    err += std::to_string(std::distance(indicesBegin, it));
     err += " is greater than the maximum vertex index (";
     err += std::to_string(nbPoints);
     err += ")";
@@ -61,6 +65,34 @@ std::pair<bool, std::string> mesh_t::isValid() const
 
   return { true, {} };
 }
+}
+
+namespace f3d
+{
+//----------------------------------------------------------------------------
+std::pair<bool, std::string> mesh_t::isValid() const
+{
+  return ::IsMeshValid({ { this->points.data(), this->points.size() },
+    { this->normals.data(), this->normals.size() },
+    { this->texture_coordinates.data(), this->texture_coordinates.size() },
+    { this->face_sides.data(), this->face_sides.size() },
+    { this->face_indices.data(), this->face_indices.size() }, {} });
+}
+
+//----------------------------------------------------------------------------
+std::pair<bool, std::string> mesh_view_t::isValid() const
+{
+  if ((this->points.size > 0 && !this->points.data) ||
+    (this->normals.size > 0 && !this->normals.data) ||
+    (this->texture_coordinates.size > 0 && !this->texture_coordinates.data) ||
+    (this->face_sides.size > 0 && !this->face_sides.data) ||
+    (this->face_indices.size > 0 && !this->face_indices.data))
+  {
+    return { false, "A non empty buffer must not be null." };
+  }
+
+  return ::IsMeshValid(*this);
+}
 
 // see function explanation in types.h for explanation of logic
 //----------------------------------------------------------------------------
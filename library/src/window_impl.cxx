@@ -579,6 +579,9 @@ void window_impl::UpdateDynamicOptions()
   renderer->SetBlurCircleOfConfusionRadius(opt.render.background.blur.coc);
   renderer->SetLightIntensity(opt.render.light.intensity);
 
+  renderer->SetUseCulling(opt.render.culling.enable);
+  renderer->SetCullingMinimumInteractionSize(opt.render.culling.interaction_size);
+
   renderer->SetHDRIFile(opt.render.hdri.file);
   renderer->SetUseImageBasedLighting(opt.render.hdri.ambient);
   renderer->ShowHDRISkybox(opt.render.background.skybox);
@@ -690,10 +693,33 @@ bool window_impl::render()
   return true;
 }
 
+//----------------------------------------------------------------------------
+window& window_impl::setRenderTimingsEnabled(bool enable)
+{
+  this->Internals->Renderer->SetTimingsEnabled(enable);
+  return *this;
+}
+
+//----------------------------------------------------------------------------
+std::vector<std::pair<std::string, double>> window_impl::getRenderTimings()
+{
+  std::vector<std::pair<std::string, double>> timings =
+    this->Internals->Renderer->GetGPUTimer()->GetTimings();
+  for (auto& timing : timings)
+  {
+    timing.second *= 1000.0;
+  }
+  return timings;
+}
+
 //----------------------------------------------------------------------------
 image window_impl::renderToImage(bool noBackground)
 {
+  // Images must contain the final HDRI, wait for any background preparation
+  const bool asyncHDRI = this->Internals->Renderer->GetHDRIAsyncPreparation();
+  this->Internals->Renderer->SetHDRIAsyncPreparation(false);
   this->render();
+  this->Internals->Renderer->SetHDRIAsyncPreparation(asyncHDRI);
 
   vtkNew<vtkWindowToImageFilter> rtW2if;
   rtW2if->SetInput(this->Internals->RenWin);
@@ -746,6 +772,12 @@ void window_impl::SetCachePath(const fs::path& cachePath)
   this->Internals->CachePath = cachePath;
 }
 
+//----------------------------------------------------------------------------
+const fs::path& window_impl::GetCachePath() const
+{
+  return this->Internals->CachePath;
+}
+
 //----------------------------------------------------------------------------
 void window_impl::SetInteractor(interactor_impl* interactor)
 {
@@ -0,0 +1,92 @@
+#include "PseudoUnitTest.h"
+
+#include <engine.h>
+#include <log.h>
+#include <options.h>
+#include <scene.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+int TestSDKGeometryCache([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::log::setVerboseLevel(f3d::log::VerboseLevel::DEBUG);
+  f3d::engine eng = f3d::engine::createNone();
+  f3d::scene& sce = eng.getScene();
+  f3d::options& opt = eng.getOptions();
+
+  // Generate a random cache path to avoid reusing any existing cache
+  std::random_device r;
+  std::default_random_engine e1(r());
+  std::uniform_int_distribution<int> dist(1, 100000);
+  fs::path cachePath = fs::path(argv[2]) / ("cache_" + std::to_string(dist(e1)));
+  eng.setCachePath(cachePath);
+
+  std::string dragon = std::string(argv[1]) + "data/dragon.vtu";
+  std::string cow = std::string(argv[1]) + "data/cow.vtp";
+  std::string logo = std::string(argv[1]) + "data/mb/recursive/f3d.glb";
+
+  // Disabled by default
+  test("add without geometry cache", [&]() { sce.add(dragon); });
+  test("no geometry cache by default", !fs::exists(cachePath / "geometry"));
+
+  // Populate the cache
+  opt.scene.geometry_cache = true;
+  test("add with geometry cache", [&]() { sce.clear().add(dragon); });
+  test("geometry cache created", fs::exists(cachePath / "geometry"));
+
+  auto countCacheEntries = [&]()
+  {
+    return std::distance(
+      fs::directory_iterator(cachePath / "geometry"), fs::directory_iterator{});
+  };
+  test("one geometry cache entry", countCacheEntries() == 1);
+
+  const fs::path cacheFile =
+    fs::directory_iterator(cachePath / "geometry")->path() / "geometry.vtu";
+  test("geometry cache file written", fs::exists(cacheFile));
+  const fs::file_time_type cacheTime = fs::last_write_time(cacheFile);
+
+  // Record geometry cache messages to check the reader is not executed
+  std::vector<std::string> messages;
+  f3d::log::forward(
+    [&](f3d::log::VerboseLevel, const std::string& msg)
+    {
+      if (msg.find("geometry cache") != std::string::npos)
+      {
+        messages.emplace_back(msg);
+      }
+    });
+  auto hasMessage = [&](const std::string& str)
+  {
+    return std::any_of(messages.begin(), messages.end(),
+      [&](const std::string& msg) { return msg.find(str) != std::string::npos; });
+  };
+
+  // Reuse the cache, no new entry expected
+  test("add from geometry cache", [&]() { sce.clear().add(dragon); });
+  test("geometry cache reused", countCacheEntries() == 1);
+  test("geometry cache file read", hasMessage("Read geometry cache file"));
+  test("geometry cache file not rewritten", !hasMessage("Wrote geometry cache file"));
+  test("geometry cache file unchanged", fs::last_write_time(cacheFile) == cacheTime);
+
+  // Scene readers are not cached
+  test("add scene reader with geometry cache", [&]() { sce.clear().add(logo); });
+  test("scene reader not cached", countCacheEntries() == 1);
+
+  // Only the geometry being loaded is kept with an empty budget
+  opt.scene.geometry_cache_budget = 0;
+  test("add another file with geometry cache", [&]() { sce.clear().add(cow); });
+  test("least recently used entry removed with an empty budget", countCacheEntries() == 1);
+  test("geometry cache file removed", !fs::exists(cacheFile));
+
+  f3d::log::forward(nullptr);
+  return test.result();
+}
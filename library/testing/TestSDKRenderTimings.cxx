@@ -0,0 +1,59 @@
+#include "PseudoUnitTest.h"
+
+#include <engine.h>
+#include <options.h>
+#include <scene.h>
+#include <window.h>
+
+#include <algorithm>
+
+namespace
+{
+bool HasTiming(const std::vector<std::pair<std::string, double>>& timings, const std::string& name)
+{
+  return std::any_of(timings.begin(), timings.end(),
+    [&](const std::pair<std::string, double>& timing) { return timing.first == name; });
+}
+}
+
+int TestSDKRenderTimings([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::engine eng = f3d::engine::create(true);
+
+  f3d::window& win = eng.getWindow();
+  win.setSize(300, 300);
+
+  f3d::scene& sce = eng.getScene();
+  sce.add(std::string(argv[1]) + "/data/cow.vtp");
+
+  f3d::options& options = eng.getOptions();
+  options.render.effect.ambient_occlusion = true;
+  options.render.effect.antialiasing.enable = true;
+  options.render.effect.antialiasing.mode = "taa";
+
+  win.render();
+  test("no timings when not enabled", win.getRenderTimings().empty());
+
+  // Timings are read back a few frames later, render until they are available
+  win.setRenderTimingsEnabled(true);
+  std::vector<std::pair<std::string, double>> timings;
+  for (int i = 0; i < 20 && timings.empty(); i++)
+  {
+    win.render();
+    timings = win.getRenderTimings();
+  }
+
+  test("timings available", !timings.empty());
+  test("first timing is the frame", !timings.empty() && timings.front().first == "Frame");
+  test("timings are positive",
+    std::all_of(timings.begin(), timings.end(),
+      [](const std::pair<std::string, double>& timing) { return timing.second >= 0.0; }));
+  test("SSAO timing", ::HasTiming(timings, "SSAO"));
+  test("TAA timing", ::HasTiming(timings, "TAA"));
+  test("overlay timing", ::HasTiming(timings, "Overlay"));
+  test("no depth peeling timing", !::HasTiming(timings, "Depth peeling"));
+
+  return test.result();
+}
@@ -61,6 +61,13 @@ int TestSDKScene([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
   test("render after add",
     TestSDKHelpers::RenderTest(win, std::string(argv[1]) + "baselines/", argv[2], "TestSDKScene"));
 
+  // reload test
+  test("reload a geometry file", [&]() { sce.reload(sphere2); });
+  test.expect<f3d::scene::load_failure_exception>(
+    "reload a file not added", [&]() { sce.reload(dummy); });
+  test.expect<f3d::scene::load_failure_exception>(
+    "reload a full scene file", [&]() { sce.reload(logo); });
+
   // light test
   f3d::light_state_t defaultLight;
   f3d::light_state_t redLight = defaultLight;
@@ -0,0 +1,62 @@
+#include "PseudoUnitTest.h"
+
+#include <engine.h>
+#include <log.h>
+#include <scene.h>
+
+#include <string>
+
+int TestSDKSceneAsync([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::log::setVerboseLevel(f3d::log::VerboseLevel::DEBUG);
+  f3d::engine eng = f3d::engine::createNone();
+  f3d::scene& sce = eng.getScene();
+
+  using status = f3d::scene::async_load::status;
+  const std::string dragon = std::string(argv[1]) + "data/dragon.vtu";
+  const std::string cow = std::string(argv[1]) + "data/cow.vtp";
+  const std::string invalid = std::string(argv[1]) + "data/invalid.vtp";
+  const std::string nonExisting = std::string(argv[1]) + "data/nonExisting.vtp";
+
+  // Checks are performed before reading
+  test.expect<f3d::scene::load_failure_exception>(
+    "addAsync with non existing file", [&]() { sce.addAsync({ nonExisting }); });
+
+  // Read and add a file
+  std::shared_ptr<f3d::scene::async_load> load = sce.addAsync({ dragon });
+  test("addAsync status", load->wait() == status::LOADED);
+  test("addAsync progress", load->getProgress() == 1.0);
+  test("addAsync wait twice", load->wait() == status::LOADED);
+
+  // Read multiple files
+  load = sce.addAsync({ cow, dragon });
+  test("addAsync multiple files status", load->wait() == status::LOADED);
+
+  // Failing read does not throw
+  load = sce.addAsync({ invalid });
+  test("addAsync invalid file status", load->wait() == status::FAILED);
+
+  // Cancel a load, it may have been read already but it is never added
+  load = sce.clear().addAsync({ dragon });
+  load->cancel();
+  test("addAsync cancelled status", load->wait() == status::CANCELLED);
+
+  // Cancelling a loaded file does nothing
+  load = sce.addAsync({ cow });
+  test("addAsync before cancel", load->wait() == status::LOADED);
+  load->cancel();
+  test("addAsync cancel after load", load->getStatus() == status::LOADED);
+
+  // Prefetch files then add them
+  test("prefetch files", [&]() { sce.prefetch({ cow, dragon }, 1000); });
+  test("add prefetched file", [&]() { sce.clear().add(dragon); });
+  test("add second prefetched file", [&]() { sce.add(cow); });
+  test("prefetch with no budget", [&]() { sce.prefetch({ cow, dragon }, 0); });
+  test("prefetch invalid files", [&]() { sce.prefetch({ invalid, nonExisting }, 1000); });
+  test.expect<f3d::scene::load_failure_exception>(
+    "add invalid prefetched file", [&]() { sce.add(invalid); });
+
+  return test.result();
+}
@@ -6,6 +6,9 @@
 #include <options.h>
 #include <scene.h>
 
+#include <fstream>
+#include <sstream>
+
 int TestSDKSceneFromBuffer([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
 {
   PseudoUnitTest test;
@@ -34,5 +37,22 @@ int TestSDKSceneFromBuffer([[maybe_unused]] int argc, [[maybe_unused]] char* arg
   test.expect<f3d::scene::load_failure_exception>(
     "add buffer with reader that doesn't support streams", [&]() { sce.add(&y, 1); });
 
+  // Add input stream with reader that doesn't support streams
+  std::istringstream invalidStream("invalid");
+  test.expect<f3d::scene::load_failure_exception>(
+    "add input stream with reader that doesn't support streams", [&]() { sce.add(invalidStream); });
+
+  // Add input stream, then add it again from its beginning
+  std::ifstream file(std::string(argv[1]) + "data/suzanne.stl", std::ios::binary);
+  opt.scene.force_reader = "STL";
+  test("add input stream", [&]() { sce.add(file); });
+  test("add input stream again",
+    [&]()
+    {
+      file.clear();
+      file.seekg(0);
+      sce.clear().add(file);
+    });
+
   return test.result();
 }
@@ -6,6 +6,8 @@
 #include <scene.h>
 #include <window.h>
 
+#include <vector>
+
 int TestSDKSceneFromMemory([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
 {
   PseudoUnitTest test;
@@ -65,5 +67,68 @@ int TestSDKSceneFromMemory([[maybe_unused]] int argc, [[maybe_unused]] char* arg
     TestSDKHelpers::RenderTest(
       win, std::string(argv[1]) + "baselines/", argv[2], "TestSDKSceneFromMemory"));
 
+  // Add mesh from external buffers, which are released once the mesh is not used anymore
+  std::vector<float> points = { 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 1.f, 0.f, 0.f, 1.f, 1.f, 0.f };
+  std::vector<float> normals = { 0.f, 0.f, -1.f, 0.f, 0.f, -1.f, 0.f, 0.f, -1.f, 0.f, 0.f, -1.f };
+  std::vector<float> tcoords = { 0.f, 0.f, 0.f, 1.f, 1.f, 0.f, 1.f, 1.f };
+  std::vector<unsigned int> sides = { 3, 3 };
+  std::vector<unsigned int> indices = { 0, 1, 2, 1, 3, 2 };
+
+  int releaseCount = 0;
+  f3d::mesh_view_t view{ { points.data(), points.size() }, { normals.data(), normals.size() },
+    { tcoords.data(), tcoords.size() }, { sides.data(), sides.size() },
+    { indices.data(), indices.size() }, [&]() { releaseCount++; } };
+
+  f3d::mesh_view_t invalidView = view;
+  invalidView.normals.size = 1;
+  test.expect<f3d::scene::load_failure_exception>(
+    "add mesh view with invalid normals", [&]() { sce.add(invalidView); });
+  test("release invalid mesh view", releaseCount, 1);
+
+  {
+    f3d::engine viewEng = f3d::engine::create(true);
+    viewEng.getOptions().model.color.texture = texturePath;
+    f3d::window& viewWin = viewEng.getWindow().setSize(300, 300);
+
+    test("add mesh view", [&]() { viewEng.getScene().add(view); });
+    test("render mesh view",
+      TestSDKHelpers::RenderTest(
+        viewWin, std::string(argv[1]) + "baselines/", argv[2], "TestSDKSceneFromMemory"));
+    test("mesh view not released while in use", releaseCount, 1);
+  }
+  test("release mesh view", releaseCount, 2);
+
+  // Update point attributes of a mesh in place, faces are kept
+  {
+    f3d::engine updateEng = f3d::engine::create(true);
+    updateEng.getOptions().model.color.texture = texturePath;
+    f3d::scene& updateSce = updateEng.getScene();
+    f3d::window& updateWin = updateEng.getWindow().setSize(300, 300);
+
+    updateSce.add(f3d::mesh_t{ points, {}, std::vector<float>(8, 0.f), sides, indices });
+    updateWin.render();
+
+    test.expect<f3d::scene::load_failure_exception>("update mesh with invalid id",
+      [&]() { updateSce.updateMesh(1, f3d::mesh_t{ points, {}, {}, {}, {} }); });
+    test.expect<f3d::scene::load_failure_exception>("update mesh faces",
+      [&]() { updateSce.updateMesh(0, f3d::mesh_t{ {}, {}, {}, sides, indices }); });
+    test.expect<f3d::scene::load_failure_exception>("update mesh with invalid number of points",
+      [&]() { updateSce.updateMesh(0, f3d::mesh_t{ { 0.f, 0.f, 0.f }, {}, {}, {}, {} }); });
+
+    test("update mesh", [&]() { updateSce.updateMesh(0, f3d::mesh_t{ points, {}, tcoords }); });
+    f3d::mesh_view_t updateView = view;
+    updateView.face_sides = {};
+    updateView.face_indices = {};
+    test("update mesh view", [&]() { updateSce.updateMesh(0, updateView); });
+    test("render updated mesh",
+      TestSDKHelpers::RenderTest(
+        updateWin, std::string(argv[1]) + "baselines/", argv[2], "TestSDKSceneFromMemory"));
+
+    test("clear mesh", [&]() { updateSce.clear(); });
+    test.expect<f3d::scene::load_failure_exception>("update cleared mesh",
+      [&]() { updateSce.updateMesh(0, f3d::mesh_t{ points, {}, {}, {}, {} }); });
+  }
+  test("release mesh view used for update", releaseCount, 3);
+
   return test.result();
 }
@@ -0,0 +1,77 @@
+#include <vtkNew.h>
+#include <vtkStreamingDemandDrivenPipeline.h>
+#include <vtkTestUtilities.h>
+
+#include "vtkF3DAlembicReader.h"
+
+#include <iostream>
+
+int TestF3DAlembicReaderAnimation(int vtkNotUsed(argc), char* argv[])
+{
+  std::string filename = std::string(argv[1]) + "data/drop.abc";
+  vtkNew<vtkF3DAlembicReader> reader;
+  reader->SetFileName(filename);
+  reader->UpdateInformation();
+
+  double* timeRange = reader->GetOutputInformation(0)->Get(
+    vtkStreamingDemandDrivenPipeline::TIME_RANGE());
+  if (!timeRange)
+  {
+    std::cerr << "No time range in drop.abc" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const double start = timeRange[0];
+  const double middle = (timeRange[0] + timeRange[1]) / 2;
+
+  reader->UpdateTimeStep(start);
+  vtkNew<vtkPolyData> first;
+  first->DeepCopy(reader->GetOutput());
+
+  reader->UpdateTimeStep(middle);
+  vtkIdType nbPoints = reader->GetOutput()->GetNumberOfPoints();
+  if (nbPoints == 0)
+  {
+    std::cerr << "Empty output at time " << middle << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Reading back the first time value, from the cache or not, must give the same result
+  reader->UpdateTimeStep(start);
+  vtkPolyData* output = reader->GetOutput();
+  if (output->GetNumberOfPoints() != first->GetNumberOfPoints() ||
+    output->GetNumberOfCells() != first->GetNumberOfCells())
+  {
+    std::cerr << "Unexpected output when reading time " << start << " again" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  double bounds[6];
+  double expectedBounds[6];
+  output->GetBounds(bounds);
+  first->GetBounds(expectedBounds);
+  for (int i = 0; i < 6; i++)
+  {
+    if (bounds[i] != expectedBounds[i])
+    {
+      std::cerr << "Unexpected bounds when reading time " << start << " again" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Without a cache, the output must be identical
+  reader->SetSampleCacheBudget(0);
+  reader->UpdateTimeStep(middle);
+  reader->UpdateTimeStep(start);
+  output = reader->GetOutput();
+  output->GetBounds(bounds);
+  for (int i = 0; i < 6; i++)
+  {
+    if (bounds[i] != expectedBounds[i])
+    {
+      std::cerr << "Unexpected bounds without sample cache" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
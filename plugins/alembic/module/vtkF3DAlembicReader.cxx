@@ -10,6 +10,7 @@
 #include <vtkPoints.h>
 #include <vtkPolyLine.h>
 #include <vtkResourceStream.h>
+#include <vtkSMPTools.h>
 #include <vtkSmartPointer.h>
 #include <vtkStreamingDemandDrivenPipeline.h>
 
@@ -26,6 +27,9 @@
 #pragma warning(pop)
 #endif
 
+#include <algorithm>
+#include <cstdint>
+#include <map>
 #include <stack>
 #include <tuple>
 
@@ -48,6 +52,51 @@ struct IntermediateGeometry
   bool nFaceVarying = false;
 };
 
+/**
+ * Topology of a mesh read from a first sample, reused for the next samples when the
+ * schema topology is constant or homogeneous.
+ */
+struct MeshTopology
+{
+  vtkSmartPointer<vtkCellArray> Polys;
+  vtkSmartPointer<vtkDataArray> UVs;
+
+  // Index of the source position and normal of each output point
+  // Empty when points are not duplicated, sources are then used in order
+  std::vector<int> PointSources;
+  std::vector<int> NormalSources;
+
+  size_t NumberOfPositions = 0;
+  size_t NumberOfNormals = 0;
+  bool ReverseRotate = true;
+};
+
+//----------------------------------------------------------------------------
+template<typename F>
+vtkSmartPointer<vtkFloatArray> CreateTransformedArray(const Alembic::Abc::V3f* values,
+  size_t nbValues, const std::vector<int>& sources, F&& transform)
+{
+  const vtkIdType nbTuples = static_cast<vtkIdType>(sources.empty() ? nbValues : sources.size());
+  vtkNew<vtkFloatArray> array;
+  array->SetNumberOfComponents(3);
+  array->SetNumberOfTuples(nbTuples);
+  float* out = array->GetPointer(0);
+
+  vtkSMPTools::For(0, nbTuples,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType i = begin; i < end; i++)
+      {
+        Alembic::Abc::V3f tp;
+        transform(values[sources.empty() ? i : sources[i]], tp);
+        out[3 * i] = tp.x;
+        out[3 * i + 1] = tp.y;
+        out[3 * i + 2] = tp.z;
+      }
+    });
+  return array;
+}
+
 class vtkF3DAlembicReader::vtkInternals
 {
   void SetupIndicesStorage(const Alembic::AbcGeom::Int32ArraySamplePtr& faceVertexCounts,
@@ -243,18 +292,140 @@ class vtkF3DAlembicReader::vtkInternals
     }
   }
 
+  /**
+   * Check if the topology, UVs and normals indexing of a mesh are the same for all samples
+   */
+  static bool HasStaticTopology(const Alembic::AbcGeom::IPolyMeshSchema& schema)
+  {
+    if (schema.getTopologyVariance() == Alembic::AbcGeom::kHeterogeneousTopology)
+    {
+      return false;
+    }
+
+    Alembic::AbcGeom::IV2fGeomParam uvsParam = schema.getUVsParam();
+    if (uvsParam.valid() && !uvsParam.isConstant())
+    {
+      return false;
+    }
+
+    Alembic::AbcGeom::IN3fGeomParam normalsParam = schema.getNormalsParam();
+    return !normalsParam.valid() || !normalsParam.isIndexed() ||
+      normalsParam.getIndexProperty().isConstant();
+  }
+
+  MeshTopology CreateTopology(
+    const IntermediateGeometry& originalData, vtkPolyData* polydata, bool reverseRotate)
+  {
+    MeshTopology topology;
+    topology.Polys = polydata->GetPolys();
+    topology.UVs = polydata->GetPointData()->GetTCoords();
+    topology.NumberOfPositions = originalData.Attributes.at("P").size();
+    auto nMapIter = originalData.Attributes.find("N");
+    topology.NumberOfNormals =
+      nMapIter != originalData.Attributes.end() ? nMapIter->second.size() : 0;
+    topology.ReverseRotate = reverseRotate;
+
+    // Same duplication as PointDuplicateAccumulator
+    if (originalData.uvFaceVarying || originalData.nFaceVarying)
+    {
+      for (const auto& perFaceIndices : originalData.Indices)
+      {
+        for (const Alembic::Abc::V3i& indices : perFaceIndices)
+        {
+          topology.PointSources.emplace_back(indices[pIndicesOffset]);
+          if (topology.NumberOfNormals > 0)
+          {
+            topology.NormalSources.emplace_back(indices[nIndicesOffset]);
+          }
+        }
+      }
+    }
+    return topology;
+  }
+
+  /**
+   * Create a polydata from a recorded topology, reading only positions and normals.
+   * Return nullptr if the sample does not match the topology.
+   */
+  vtkSmartPointer<vtkPolyData> UpdateFromTopology(const MeshTopology& topology,
+    const Alembic::AbcGeom::IPolyMeshSchema& schema,
+    const Alembic::AbcGeom::ISampleSelector& selector, const Alembic::Abc::M44d& matrix)
+  {
+    Alembic::AbcGeom::P3fArraySamplePtr positions;
+    schema.getPositionsProperty().get(positions, selector);
+    if (!positions || positions->size() != topology.NumberOfPositions)
+    {
+      return nullptr;
+    }
+
+    Alembic::AbcGeom::IN3fGeomParam::Sample normalValue;
+    if (topology.NumberOfNormals > 0)
+    {
+      normalValue = schema.getNormalsParam().getIndexedValue(selector);
+      if (!normalValue.valid() || normalValue.getVals()->size() != topology.NumberOfNormals)
+      {
+        return nullptr;
+      }
+    }
+
+    vtkNew<vtkPolyData> polydata;
+    vtkNew<vtkPoints> points;
+    points->SetData(::CreateTransformedArray(positions->get(), positions->size(),
+      topology.PointSources, [&](const Alembic::Abc::V3f& src, Alembic::Abc::V3f& dst)
+      { matrix.multVecMatrix(src, dst); }));
+    polydata->SetPoints(points);
+    polydata->SetPolys(topology.Polys);
+
+    vtkDataSetAttributes* pointAttributes = polydata->GetAttributes(vtkDataSet::POINT);
+    if (topology.NumberOfNormals > 0)
+    {
+      vtkSmartPointer<vtkFloatArray> normals = ::CreateTransformedArray(
+        normalValue.getVals()->get(), normalValue.getVals()->size(), topology.NormalSources,
+        [&](const Alembic::Abc::V3f& src, Alembic::Abc::V3f& dst)
+        { matrix.multDirMatrix(src, dst); });
+      normals->SetName("Normals");
+      pointAttributes->SetNormals(normals);
+    }
+
+    if (topology.UVs)
+    {
+      pointAttributes->SetTCoords(topology.UVs);
+    }
+
+    return polydata;
+  }
+
 public:
   vtkSmartPointer<vtkPolyData> ProcessIPolyMesh(
     const Alembic::AbcGeom::IPolyMesh& pmesh, double time, const Alembic::Abc::M44d& matrix)
   {
     vtkNew<vtkPolyData> polydata;
     IntermediateGeometry originalData;
+    bool doReverseRotate = true;
 
     Alembic::AbcGeom::IPolyMeshSchema::Sample samp;
     const Alembic::AbcGeom::IPolyMeshSchema& schema = pmesh.getSchema();
     if (schema.getNumSamples() > 0)
     {
       Alembic::AbcGeom::ISampleSelector selector(time);
+
+      // By default, Alembic is CW while VTK is CCW
+      // So we need to reverse the order of indices only if the mesh is not mirrored
+      doReverseRotate = matrix.determinant() > 0;
+
+      // When the topology is already known, only positions and normals are read
+      auto topologyIt = this->Topologies.find(pmesh.getFullName());
+      if (topologyIt != this->Topologies.end() &&
+        topologyIt->second.ReverseRotate == doReverseRotate)
+      {
+        vtkSmartPointer<vtkPolyData> updated =
+          this->UpdateFromTopology(topologyIt->second, schema, selector, matrix);
+        if (updated)
+        {
+          return updated;
+        }
+      }
+
       schema.get(samp, selector);
 
       Alembic::AbcGeom::P3fArraySamplePtr positions = samp.getPositions();
@@ -263,10 +434,6 @@ public:
 
       this->SetupIndicesStorage(faceVertexCounts, originalData.Indices);
 
-      // By default, Alembic is CW while VTK is CCW
-      // So we need to reverse the order of indices only if the mesh is not mirrored
-      const bool doReverseRotate = matrix.determinant() > 0;
-
       // Positions
       {
         V3fContainer pV3F;
@@ -352,6 +519,12 @@ public:
 
     this->FillPolyData(duplicatedData, polydata);
 
+    if (polydata->GetPoints() && vtkInternals::HasStaticTopology(schema))
+    {
+      this->Topologies[pmesh.getFullName()] =
+        this->CreateTopology(originalData, polydata, doReverseRotate);
+    }
+
     return polydata;
   }
 
@@ -551,8 +724,68 @@ public:
     }
     return this->Archive.valid();
   }
+
+  /**
+   * Return a previously read output for this time value, or nullptr
+   */
+  vtkPolyData* FindSample(double time)
+  {
+    auto it = this->Samples.find(time);
+    if (it == this->Samples.end())
+    {
+      return nullptr;
+    }
+    it->second.LastUse = ++this->SampleUseCounter;
+    return it->second.Output;
+  }
+
+  /**
+   * Store an output for this time value, then release least recently used outputs
+   * until the cache fits the budget, in MiB
+   */
+  void AddSample(double time, vtkPolyData* output, double budget)
+  {
+    CachedSample& sample = this->Samples[time];
+    sample.Output = output;
+    sample.LastUse = ++this->SampleUseCounter;
+
+    std::vector<std::pair<uint64_t, double>> samplesByUse;
+    double size = 0;
+    for (const auto& [sampleTime, cached] : this->Samples)
+    {
+      size += static_cast<double>(cached.Output->GetActualMemorySize()) * 1024;
+      samplesByUse.emplace_back(cached.LastUse, sampleTime);
+    }
+
+    std::sort(samplesByUse.begin(), samplesByUse.end());
+    const double budgetBytes = budget * 1024 * 1024;
+    for (auto it = samplesByUse.begin(); it != samplesByUse.end() && size > budgetBytes; ++it)
+    {
+      auto sampleIt = this->Samples.find(it->second);
+      size -= static_cast<double>(sampleIt->second.Output->GetActualMemorySize()) * 1024;
+      this->Samples.erase(sampleIt);
+    }
+  }
+
+  void ClearCaches()
+  {
+    this->Topologies.clear();
+    this->Samples.clear();
+  }
+
   Alembic::Abc::IArchive Archive;
 
+  // Topologies of constant and homogeneous meshes, by object full name
+  std::map<std::string, MeshTopology> Topologies;
+
+  struct CachedSample
+  {
+    vtkSmartPointer<vtkPolyData> Output;
+    uint64_t LastUse = 0;
+  };
+  std::map<double, CachedSample> Samples;
+  uint64_t SampleUseCounter = 0;
+
 #if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251210)
   std::unique_ptr<std::streambuf> Streambuf;
   std::unique_ptr<std::istream> Buffer;
@@ -576,6 +809,7 @@ vtkF3DAlembicReader::~vtkF3DAlembicReader() = default;
 int vtkF3DAlembicReader::RequestInformation(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
 {
+  this->Internals->ClearCaches();
   if (!this->Internals->ReadArchive(this->Stream, this->FileName, this))
   {
     vtkErrorMacro("Unable to read this alembic file or stream");
@@ -609,11 +843,19 @@ int vtkF3DAlembicReader::RequestData(
     requestedTimeValue = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
   }
 
+  vtkPolyData* cached = this->Internals->FindSample(requestedTimeValue);
+  if (cached)
+  {
+    output->ShallowCopy(cached);
+    return 1;
+  }
+
   vtkNew<vtkAppendPolyData> append;
   this->Internals->ImportRoot(append, requestedTimeValue);
   append->Update();
 
   output->ShallowCopy(append->GetOutput());
+  this->Internals->AddSample(requestedTimeValue, append->GetOutput(), this->SampleCacheBudget);
 
   return 1;
 }
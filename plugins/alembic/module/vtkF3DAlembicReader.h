@@ -34,6 +34,15 @@ public:
    */
   vtkSetMacro(FileName, std::string);
 
+  /**
+   * Set/Get the memory budget, in MiB, of the cache of already read time samples.
+   * Reading a time value that is already in the cache does not access the archive.
+   * Least recently read time samples are released first, 0 disables the cache.
+   * Default is 512.
+   */
+  vtkSetClampMacro(SampleCacheBudget, double, 0, VTK_DOUBLE_MAX);
+  vtkGetMacro(SampleCacheBudget, double);
+
   /**
    * Specify stream to read from
    * Only Ogawa version of alembic format is supported.
@@ -67,6 +76,7 @@ private:
 
   vtkSmartPointer<vtkResourceStream> Stream;
   std::string FileName;
+  double SampleCacheBudget = 512;
 
   class vtkInternals;
   std::unique_ptr<vtkInternals> Internals;
@@ -1,10 +1,13 @@
 #include "vtkF3DAssimpImporter.h"
 
+#include "F3DTextureDecoder.h"
+
 #include <vtkActor.h>
 #include <vtkActorCollection.h>
 #include <vtkCamera.h>
 #include <vtkDoubleArray.h>
 #include <vtkFloatArray.h>
+#include <vtkIdTypeArray.h>
 #include <vtkImageData.h>
 #include <vtkImageReader2.h>
 #include <vtkImageReader2Factory.h>
@@ -19,6 +22,7 @@
 #include <vtkProperty.h>
 #include <vtkQuaternion.h>
 #include <vtkRenderer.h>
+#include <vtkSMPTools.h>
 #include <vtkShaderProperty.h>
 #include <vtkSmartPointer.h>
 #include <vtkStringArray.h>
@@ -39,9 +43,13 @@
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 
+#include <algorithm>
+#include <cassert>
+#include <cstring>
 #include <memory>
 #include <regex>
 #include <set>
+#include <type_traits>
 
 vtkStandardNewMacro(vtkF3DAssimpImporter);
 
@@ -165,6 +173,74 @@ public:
     }
   }
 
+  //----------------------------------------------------------------------------
+  /**
+   * Find a texture file relative to the model file
+   * Return an empty string if it cannot be found
+   */
+  std::string ResolveTexturePath(const char* path)
+  {
+    std::string dir = vtksys::SystemTools::GetParentDirectory(this->Parent->GetFileName());
+    std::string texturePath = vtksys::SystemTools::CollapseFullPath(path, dir);
+
+    // try to get the texture in the same dir as the model file
+    if (!vtksys::SystemTools::FileExists(texturePath))
+    {
+      std::string fileName = vtksys::SystemTools::GetFilenameName(path);
+      texturePath = vtksys::SystemTools::CollapseFullPath(fileName, dir);
+    }
+
+    return vtksys::SystemTools::FileExists(texturePath) ? texturePath : std::string();
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * Start decoding all external texture files used by the materials on the shared decode pool
+   * so that CreateMaterial gets them from the cache instead of decoding them one by one
+   */
+  void PrefetchTextures()
+  {
+    if (!this->Parent->GetFileName())
+    {
+      return;
+    }
+
+    for (unsigned int i = 0; i < this->Scene->mNumMaterials; i++)
+    {
+      const aiMaterial* material = this->Scene->mMaterials[i];
+      for (aiTextureType type : { aiTextureType_DIFFUSE, aiTextureType_NORMALS,
+             aiTextureType_BASE_COLOR, aiTextureType_EMISSIVE })
+      {
+        aiString texPath;
+        if (material->GetTexture(type, 0, &texPath) == aiReturn_SUCCESS &&
+          texPath.C_Str()[0] != '*' && !this->Scene->GetEmbeddedTexture(texPath.C_Str()))
+        {
+          std::string texturePath = this->ResolveTexturePath(texPath.C_Str());
+          if (!texturePath.empty())
+          {
+            F3DTextureDecoder::DecodeFile(texturePath);
+          }
+        }
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * Wait for embedded textures being decoded and connect them to their VTK texture
+   */
+  void ResolvePendingTextures()
+  {
+    for (const auto& [texture, image] : this->PendingTextures)
+    {
+      if (image.get())
+      {
+        texture->SetInputData(image.get());
+      }
+    }
+    this->PendingTextures.clear();
+  }
+
   //----------------------------------------------------------------------------
   /**
    * Generate a VTK texture from a file path
@@ -194,46 +270,30 @@ public:
       }
       else
       {
-        const char* filename = this->Parent->GetFileName();
-        if (!filename)
+        if (!this->Parent->GetFileName())
         {
           vtkWarningWithObjectMacro(
             this->Parent, "Cannot read texture from file without a filename");
           return nullptr;
         }
 
-        std::string dir = vtksys::SystemTools::GetParentDirectory(filename);
-        std::string texturePath = vtksys::SystemTools::CollapseFullPath(path, dir);
-
-        // try to get the texture in the same dir as the model file
-        if (!vtksys::SystemTools::FileExists(texturePath))
+        std::string texturePath = this->ResolveTexturePath(path);
+        if (texturePath.empty())
         {
-          std::string fileName = vtksys::SystemTools::GetFilenameName(path);
-          texturePath = vtksys::SystemTools::CollapseFullPath(fileName, dir);
+          vtkWarningWithObjectMacro(this->Parent, "Cannot find texture: " << path);
+          return nullptr;
         }
 
-        if (vtksys::SystemTools::FileExists(texturePath))
-        {
-          vtkSmartPointer<vtkImageReader2> reader;
-          reader.TakeReference(vtkImageReader2Factory::CreateImageReader2(texturePath.c_str()));
-
-          if (!reader)
-          {
-            vtkWarningWithObjectMacro(
-              this->Parent, "Cannot instantiate the image reader for texture: " << texturePath);
-            return nullptr;
-          }
-
-          reader->SetFileName(texturePath.c_str());
-
-          vTexture = vtkSmartPointer<vtkTexture>::New();
-          vTexture->SetInputConnection(reader->GetOutputPort());
-        }
-        else
+        vtkSmartPointer<vtkImageData> image = F3DTextureDecoder::DecodeFile(texturePath).get();
+        if (!image)
         {
-          vtkWarningWithObjectMacro(this->Parent, "Cannot find texture: " << texturePath);
+          vtkWarningWithObjectMacro(
+            this->Parent, "Cannot instantiate the image reader for texture: " << texturePath);
           return nullptr;
         }
+
+        vTexture = vtkSmartPointer<vtkTexture>::New();
+        vTexture->SetInputData(image);
       }
     }
 
@@ -271,8 +331,8 @@ public:
         reader->SetMemoryBuffer(aTexture->pcData);
         reader->SetMemoryBufferLength(aTexture->mWidth);
 #endif
-        reader->Update();
-        vTexture->SetInputConnection(reader->GetOutputPort());
+        // decoded on the shared decode pool, see ResolvePendingTextures
+        this->PendingTextures.emplace_back(vTexture, F3DTextureDecoder::DecodeReader(reader));
       }
     }
     else
@@ -400,6 +460,29 @@ public:
     return property;
   }
 
+  //----------------------------------------------------------------------------
+  /**
+   * Copy an ASSIMP vector or color buffer into a preallocated float array
+   * Use a single memcpy when ASSIMP is built with single precision
+   */
+  template<typename T>
+  static void CopyTuples(const T* source, unsigned int nbTuples, vtkFloatArray* target)
+  {
+    constexpr int nbComponents = sizeof(T) / sizeof(ai_real);
+    assert(target->GetNumberOfComponents() == nbComponents);
+    float* targetPtr = target->GetPointer(0);
+    if constexpr (std::is_same_v<ai_real, float>)
+    {
+      std::memcpy(targetPtr, source, sizeof(T) * nbTuples);
+    }
+    else
+    {
+      const ai_real* sourcePtr = reinterpret_cast<const ai_real*>(source);
+      std::transform(sourcePtr, sourcePtr + nbComponents * nbTuples, targetPtr,
+        [](ai_real v) { return static_cast<float>(v); });
+    }
+  }
+
   //----------------------------------------------------------------------------
   /**
    * Generate a VTK polyData from ASSIMP mesh
@@ -409,12 +492,9 @@ public:
     vtkNew<vtkPolyData> polyData;
 
     vtkNew<vtkPoints> points;
+    points->SetDataTypeToFloat();
     points->SetNumberOfPoints(mesh->mNumVertices);
-    for (unsigned int i = 0; i < mesh->mNumVertices; i++)
-    {
-      const aiVector3D& p = mesh->mVertices[i];
-      points->SetPoint(i, p.x, p.y, p.z);
-    }
+    CopyTuples(mesh->mVertices, mesh->mNumVertices, vtkFloatArray::SafeDownCast(points->GetData()));
     polyData->SetPoints(points);
 
     if (mesh->HasNormals())
@@ -423,12 +503,7 @@ public:
       normals->SetNumberOfComponents(3);
       normals->SetName("Normal");
       normals->SetNumberOfTuples(mesh->mNumVertices);
-      for (unsigned int i = 0; i < mesh->mNumVertices; i++)
-      {
-        const aiVector3D& n = mesh->mNormals[i];
-        float tuple[3] = { n.x, n.y, n.z };
-        normals->SetTypedTuple(i, tuple);
-      }
+      CopyTuples(mesh->mNormals, mesh->mNumVertices, normals);
       polyData->GetPointData()->SetNormals(normals);
     }
 
@@ -440,11 +515,12 @@ public:
       tcoords->SetNumberOfComponents(2);
       tcoords->SetName("UV");
       tcoords->SetNumberOfTuples(mesh->mNumVertices);
+      const aiVector3D* uvs = mesh->mTextureCoords[textureIndex];
+      float* tcoordsPtr = tcoords->GetPointer(0);
       for (unsigned int i = 0; i < mesh->mNumVertices; i++)
       {
-        const aiVector3D& t = mesh->mTextureCoords[textureIndex][i];
-        float tuple[2] = { t.x, t.y };
-        tcoords->SetTypedTuple(i, tuple);
+        tcoordsPtr[2 * i] = static_cast<float>(uvs[i].x);
+        tcoordsPtr[2 * i + 1] = static_cast<float>(uvs[i].y);
       }
       polyData->GetPointData()->SetTCoords(tcoords);
     }
@@ -455,12 +531,7 @@ public:
       tangents->SetNumberOfComponents(3);
       tangents->SetName("Tangents");
       tangents->SetNumberOfTuples(mesh->mNumVertices);
-      for (unsigned int i = 0; i < mesh->mNumVertices; i++)
-      {
-        const aiVector3D& t = mesh->mTangents[i];
-        float tuple[3] = { t.x, t.y, t.z };
-        tangents->SetTypedTuple(i, tuple);
-      }
+      CopyTuples(mesh->mTangents, mesh->mNumVertices, tangents);
       polyData->GetPointData()->SetTangents(tangents);
     }
 
@@ -470,45 +541,58 @@ public:
       colors->SetNumberOfComponents(4);
       colors->SetName("Colors");
       colors->SetNumberOfTuples(mesh->mNumVertices);
-      for (unsigned int i = 0; i < mesh->mNumVertices; i++)
-      {
-        const aiColor4D& c = mesh->mColors[0][i];
-        float tuple[4] = { c.r, c.g, c.b, c.a };
-        colors->SetTypedTuple(i, tuple);
-      }
+      CopyTuples(mesh->mColors[0], mesh->mNumVertices, colors);
       polyData->GetPointData()->SetScalars(colors);
     }
 
-    vtkNew<vtkCellArray> verticesCells;
-    vtkNew<vtkCellArray> linesCells;
-    vtkNew<vtkCellArray> polysCells;
+    // count faces per type first so the cell arrays can be filled without reallocation
+    // 0: vertices, 1: lines, 2: polygons
+    auto cellType = [](unsigned int nbIndices)
+    { return nbIndices == 1 ? 0 : (nbIndices == 2 ? 1 : 2); };
+    vtkIdType nbCells[3] = { 0, 0, 0 };
+    vtkIdType connectivitySize[3] = { 0, 0, 0 };
+    for (unsigned int i = 0; i < mesh->mNumFaces; i++)
+    {
+      const unsigned int nbIndices = mesh->mFaces[i].mNumIndices;
+      const int type = cellType(nbIndices);
+      nbCells[type]++;
+      connectivitySize[type] += nbIndices;
+    }
+
+    vtkNew<vtkIdTypeArray> offsets[3];
+    vtkNew<vtkIdTypeArray> connectivity[3];
+    vtkIdType* offsetsPtr[3];
+    vtkIdType* connectivityPtr[3];
+    for (int type = 0; type < 3; type++)
+    {
+      offsets[type]->SetNumberOfValues(nbCells[type] + 1);
+      connectivity[type]->SetNumberOfValues(connectivitySize[type]);
+      offsetsPtr[type] = offsets[type]->GetPointer(0);
+      connectivityPtr[type] = connectivity[type]->GetPointer(0);
+      *offsetsPtr[type] = 0;
+    }
 
     for (unsigned int i = 0; i < mesh->mNumFaces; i++)
     {
       const aiFace& face = mesh->mFaces[i];
-
-      if (face.mNumIndices == 1)
-      {
-        vtkIdType vId = static_cast<vtkIdType>(face.mIndices[0]);
-        verticesCells->InsertNextCell(1, &vId);
-      }
-      else if (face.mNumIndices == 2)
+      const int type = cellType(face.mNumIndices);
+      vtkIdType*& conn = connectivityPtr[type];
+      for (unsigned int j = 0; j < face.mNumIndices; j++)
       {
-        vtkIdType fId[2] = { static_cast<vtkIdType>(face.mIndices[0]),
-          static_cast<vtkIdType>(face.mIndices[1]) };
-        linesCells->InsertNextCell(2, fId);
-      }
-      else
-      {
-        vtkIdType fId[AI_MAX_FACE_INDICES];
-        for (unsigned int j = 0; j < face.mNumIndices; j++)
-        {
-          fId[j] = static_cast<vtkIdType>(face.mIndices[j]);
-        }
-        polysCells->InsertNextCell(face.mNumIndices, fId);
+        *conn++ = static_cast<vtkIdType>(face.mIndices[j]);
       }
+      vtkIdType*& offset = offsetsPtr[type];
+      offset[1] = offset[0] + face.mNumIndices;
+      offset++;
     }
 
+    vtkNew<vtkCellArray> verticesCells;
+    vtkNew<vtkCellArray> linesCells;
+    vtkNew<vtkCellArray> polysCells;
+    verticesCells->SetData(offsets[0], connectivity[0]);
+    linesCells->SetData(offsets[1], connectivity[1]);
+    polysCells->SetData(offsets[2], connectivity[2]);
+
     polyData->SetVerts(verticesCells);
     polyData->SetLines(linesCells);
     polyData->SetPolys(polysCells);
@@ -653,19 +737,24 @@ public:
 
     if (this->Scene)
     {
-      // convert meshes to polyData
-      this->Meshes.resize(this->Scene->mNumMeshes);
-      for (unsigned int i = 0; i < this->Scene->mNumMeshes; i++)
-      {
-        this->Meshes[i] = this->CreateMesh(this->Scene->mMeshes[i]);
-      }
-
-      // read embedded textures
+      // read embedded textures, decoding starts first so it overlaps with meshes conversion
       this->EmbeddedTextures.resize(this->Scene->mNumTextures);
       for (unsigned int i = 0; i < this->Scene->mNumTextures; i++)
       {
         this->EmbeddedTextures[i] = this->CreateEmbeddedTexture(this->Scene->mTextures[i]);
       }
+      this->PrefetchTextures();
+
+      // convert meshes to polyData, they are independent so they are converted concurrently
+      this->Meshes.resize(this->Scene->mNumMeshes);
+      vtkSMPTools::For(0, static_cast<vtkIdType>(this->Scene->mNumMeshes),
+        [&](vtkIdType begin, vtkIdType end)
+        {
+          for (vtkIdType i = begin; i < end; i++)
+          {
+            this->Meshes[i] = this->CreateMesh(this->Scene->mMeshes[i]);
+          }
+        });
 
       // convert materials to properties
       this->Properties.resize(this->Scene->mNumMaterials);
@@ -673,6 +762,7 @@ public:
       {
         this->Properties[i] = this->CreateMaterial(this->Scene->mMaterials[i]);
       }
+      this->ResolvePendingTextures();
       return true;
     }
     else
@@ -935,6 +1025,7 @@ public:
   std::vector<vtkSmartPointer<vtkPolyData>> Meshes;
   std::vector<vtkSmartPointer<vtkProperty>> Properties;
   std::vector<vtkSmartPointer<vtkTexture>> EmbeddedTextures;
+  std::vector<std::pair<vtkSmartPointer<vtkTexture>, F3DTextureDecoder::Image>> PendingTextures;
   vtkIdType ActiveAnimation = -1; // -1 means no animation enabled here
   std::vector<std::pair<std::string, vtkSmartPointer<vtkLight>>> Lights;
   std::vector<
@@ -0,0 +1,55 @@
+#include "vtkF3DDracoReader.h"
+
+#include <vtkDataArray.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPolyData.h>
+
+#include <iostream>
+
+int TestF3DDracoReaderAttributes(int vtkNotUsed(argc), char* argv[])
+{
+  std::string filename = std::string(argv[1]) + "data/colored_quad.drc";
+  vtkNew<vtkF3DDracoReader> reader;
+  reader->SetFileName(filename);
+  reader->Update();
+
+  vtkPolyData* output = reader->GetOutput();
+  if (output->GetNumberOfPoints() != 4 || output->GetNumberOfPolys() != 2)
+  {
+    std::cerr << "Unexpected geometry\n";
+    return EXIT_FAILURE;
+  }
+
+  // Normals are stored as normalized int8 and colors as normalized uint8
+  vtkDataArray* normals = output->GetPointData()->GetNormals();
+  vtkDataArray* colors = output->GetPointData()->GetScalars();
+  if (!normals || normals->GetDataType() != VTK_CHAR || normals->GetNumberOfComponents() != 3 ||
+    !colors || colors->GetDataType() != VTK_UNSIGNED_CHAR || colors->GetNumberOfComponents() != 4)
+  {
+    std::cerr << "Unexpected normals or colors arrays\n";
+    return EXIT_FAILURE;
+  }
+
+  constexpr double expectedColors[4][4] = { { 255, 0, 0, 255 }, { 0, 255, 0, 255 },
+    { 0, 0, 255, 255 }, { 255, 255, 0, 128 } };
+  for (vtkIdType i = 0; i < 4; i++)
+  {
+    if (normals->GetComponent(i, 0) != 0 || normals->GetComponent(i, 1) != 0 ||
+      normals->GetComponent(i, 2) != 127)
+    {
+      std::cerr << "Unexpected normal at point " << i << "\n";
+      return EXIT_FAILURE;
+    }
+    for (int j = 0; j < 4; j++)
+    {
+      if (colors->GetComponent(i, j) != expectedColors[i][j])
+      {
+        std::cerr << "Unexpected color at point " << i << "\n";
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
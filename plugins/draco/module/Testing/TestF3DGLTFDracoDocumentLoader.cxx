@@ -0,0 +1,61 @@
+#include "vtkF3DGLTFDracoDocumentLoader.h"
+
+#include <vtkNew.h>
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+//----------------------------------------------------------------------------
+// Check the buffer decoded for an accessor holds the expected values
+template<typename T>
+bool CheckDecodedValues(const vtkGLTFDocumentLoader::Model& model, int accessorId,
+  const std::vector<T>& expected)
+{
+  const vtkGLTFDocumentLoader::Accessor& accessor = model.Accessors[accessorId];
+  if (accessor.BufferView < 0)
+  {
+    std::cerr << "Accessor " << accessorId << " not decoded\n";
+    return false;
+  }
+
+  const std::vector<char>& buffer = model.Buffers[model.BufferViews[accessor.BufferView].Buffer];
+  if (buffer.size() != expected.size() * sizeof(T) ||
+    std::memcmp(buffer.data(), expected.data(), buffer.size()) != 0)
+  {
+    std::cerr << "Unexpected values decoded for accessor " << accessorId << "\n";
+    return false;
+  }
+  return true;
+}
+}
+
+int TestF3DGLTFDracoDocumentLoader(int vtkNotUsed(argc), char* argv[])
+{
+  std::string filename = std::string(argv[1]) + "data/colored_quad_draco.gltf";
+  vtkNew<vtkF3DGLTFDracoDocumentLoader> loader;
+  if (!loader->LoadModelMetaDataFromFile(filename) || !loader->LoadModelData({}))
+  {
+    std::cerr << "Cannot load the model\n";
+    return EXIT_FAILURE;
+  }
+
+  // Both primitives share the same Draco buffer, decoded with different index types
+  const std::vector<uint8_t> indices8 = { 0, 1, 2, 0, 2, 3 };
+  const std::vector<uint32_t> indices32 = { 0, 1, 2, 0, 2, 3 };
+  const std::vector<float> positions = { 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0 };
+  const std::vector<float> normals = { 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1 };
+  const std::vector<uint8_t> colors = { 255, 0, 0, 255, 0, 255, 0, 255, 0, 0, 255, 255, 255, 255,
+    0, 128 };
+
+  const vtkGLTFDocumentLoader::Model& model = *loader->GetInternalModel();
+  return ::CheckDecodedValues(model, 0, indices8) && ::CheckDecodedValues(model, 1, positions) &&
+      ::CheckDecodedValues(model, 2, normals) && ::CheckDecodedValues(model, 3, colors) &&
+      ::CheckDecodedValues(model, 4, indices32) && ::CheckDecodedValues(model, 5, positions) &&
+      ::CheckDecodedValues(model, 6, colors)
+    ? EXIT_SUCCESS
+    : EXIT_FAILURE;
+}
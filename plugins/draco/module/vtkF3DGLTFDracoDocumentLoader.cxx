@@ -1,8 +1,11 @@
 #include "vtkF3DGLTFDracoDocumentLoader.h"
 
 #include <vtkObjectFactory.h>
+#include <vtkSMPTools.h>
 
 #include <algorithm>
+#include <cstring>
+#include <type_traits>
 
 #include "draco/compression/decode.h"
 
@@ -17,7 +20,7 @@ std::vector<char> ComponentDispatcher(vtkGLTFDocumentLoader::ComponentType compT
     case vtkGLTFDocumentLoader::ComponentType::BYTE:
       return Decoder().template decode<int8_t>(args...);
     case vtkGLTFDocumentLoader::ComponentType::UNSIGNED_BYTE:
-      return Decoder().template decode<uint16_t>(args...);
+      return Decoder().template decode<uint8_t>(args...);
     case vtkGLTFDocumentLoader::ComponentType::SHORT:
       return Decoder().template decode<int16_t>(args...);
     case vtkGLTFDocumentLoader::ComponentType::UNSIGNED_SHORT:
@@ -33,23 +36,67 @@ std::vector<char> ComponentDispatcher(vtkGLTFDocumentLoader::ComponentType compT
   return {};
 }
 
+//----------------------------------------------------------------------------
+template<typename T>
+constexpr draco::DataType GetDracoDataType()
+{
+  if constexpr (std::is_same_v<T, int8_t>)
+  {
+    return draco::DT_INT8;
+  }
+  else if constexpr (std::is_same_v<T, uint8_t>)
+  {
+    return draco::DT_UINT8;
+  }
+  else if constexpr (std::is_same_v<T, int16_t>)
+  {
+    return draco::DT_INT16;
+  }
+  else if constexpr (std::is_same_v<T, uint16_t>)
+  {
+    return draco::DT_UINT16;
+  }
+  else if constexpr (std::is_same_v<T, uint32_t>)
+  {
+    return draco::DT_UINT32;
+  }
+  else if constexpr (std::is_same_v<T, float>)
+  {
+    return draco::DT_FLOAT32;
+  }
+  return draco::DT_INVALID;
+}
+
 //----------------------------------------------------------------------------
 struct IndexBufferDecoder
 {
   template<typename T>
   std::vector<char> decode(const std::unique_ptr<draco::Mesh>& mesh)
   {
-    std::vector<char> outBuffer(mesh->num_faces() * 3 * sizeof(T));
-
-    for (draco::FaceIndex f(0); f < mesh->num_faces(); ++f)
+    const size_t nbIndices = mesh->num_faces() * 3;
+    std::vector<char> outBuffer(nbIndices * sizeof(T));
+    if (nbIndices == 0)
     {
-      const draco::Mesh::Face& face = mesh->face(f);
-
-      T indices[3] = { static_cast<T>(face[0].value()), static_cast<T>(face[1].value()),
-        static_cast<T>(face[2].value()) };
+      return outBuffer;
+    }
 
-      std::copy(
-        indices, indices + 3, reinterpret_cast<T*>(outBuffer.data() + f.value() * sizeof(indices)));
+    // Faces are stored contiguously as 3 point indices, copy them at once when possible
+    static_assert(sizeof(draco::Mesh::Face) == 3 * sizeof(uint32_t));
+    if constexpr (std::is_same_v<T, uint32_t>)
+    {
+      std::memcpy(outBuffer.data(), &mesh->face(draco::FaceIndex(0)), outBuffer.size());
+    }
+    else
+    {
+      T* out = reinterpret_cast<T*>(outBuffer.data());
+      for (draco::FaceIndex f(0); f < mesh->num_faces(); ++f)
+      {
+        const draco::Mesh::Face& face = mesh->face(f);
+        for (int k = 0; k < 3; k++)
+        {
+          out[3 * f.value() + k] = static_cast<T>(face[k].value());
+        }
+      }
     }
 
     return outBuffer;
@@ -73,18 +120,29 @@ struct VertexBufferDecoder
   std::vector<char> decode(
     const std::unique_ptr<draco::Mesh>& mesh, const draco::PointAttribute* attribute)
   {
-    std::vector<char> outBuffer(mesh->num_points() * attribute->num_components() * sizeof(T));
-    std::vector<T> values(attribute->num_components());
+    const int nbComponents = attribute->num_components();
+    const size_t tupleSize = nbComponents * sizeof(T);
+    std::vector<char> outBuffer(mesh->num_points() * tupleSize);
+    if (outBuffer.empty())
+    {
+      return outBuffer;
+    }
 
-    size_t byteOffset = 0;
+    // Values are already stored as expected, copy them at once
+    if (attribute->is_mapping_identity() && attribute->data_type() == ::GetDracoDataType<T>() &&
+      attribute->byte_stride() == static_cast<int64_t>(tupleSize) &&
+      attribute->size() >= mesh->num_points())
+    {
+      std::memcpy(
+        outBuffer.data(), attribute->GetAddress(draco::AttributeValueIndex(0)), outBuffer.size());
+      return outBuffer;
+    }
+
+    T* out = reinterpret_cast<T*>(outBuffer.data());
     for (draco::PointIndex i(0); i < mesh->num_points(); ++i)
     {
       attribute->ConvertValue<T>(
-        attribute->mapped_index(i), attribute->num_components(), values.data());
-
-      std::copy(values.begin(), values.end(), reinterpret_cast<T*>(outBuffer.data() + byteOffset));
-
-      byteOffset += sizeof(T) * attribute->num_components();
+        attribute->mapped_index(i), nbComponents, out + i.value() * nbComponents);
     }
 
     return outBuffer;
@@ -98,6 +156,20 @@ std::vector<char> DecodeVertexBuffer(vtkGLTFDocumentLoader::ComponentType compTy
   return ComponentDispatcher<VertexBufferDecoder>(
     compType, mesh, mesh->GetAttributeByUniqueId(attIndex));
 }
+
+//----------------------------------------------------------------------------
+/**
+ * Buffers decoded from a Draco compressed primitive
+ */
+struct DecodedPrimitive
+{
+  vtkGLTFDocumentLoader::Primitive* Primitive = nullptr;
+  bool Valid = false;
+  std::vector<char> Indices;
+  int NumberOfIndices = 0;
+  std::vector<std::pair<int, std::vector<char>>> Attributes; // accessor index, decoded buffer
+  int NumberOfPoints = 0;
+};
 }
 
 //----------------------------------------------------------------------------
@@ -116,67 +188,102 @@ void vtkF3DGLTFDracoDocumentLoader::PrepareData()
 {
   std::shared_ptr<Model> model = this->GetInternalModel();
 
-  for (size_t i = 0; i < model->Meshes.size(); i++)
+  std::vector<DecodedPrimitive> decodedPrimitives;
+  for (Mesh& mesh : model->Meshes)
   {
-    for (Primitive& primitive : model->Meshes[i].Primitives)
+    for (Primitive& primitive : mesh.Primitives)
     {
       // check if Draco metadata is present
-      auto& dracoMetaData = primitive.ExtensionMetaData.KHRDracoMetaData;
-      if (dracoMetaData.BufferView >= 0)
+      if (primitive.ExtensionMetaData.KHRDracoMetaData.BufferView >= 0)
+      {
+        decodedPrimitives.emplace_back().Primitive = &primitive;
+      }
+    }
+  }
+
+  // Primitives are independent, decode them concurrently without modifying the model
+  vtkSMPTools::For(0, static_cast<vtkIdType>(decodedPrimitives.size()),
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType i = begin; i < end; i++)
       {
-        auto& view = model->BufferViews[primitive.ExtensionMetaData.KHRDracoMetaData.BufferView];
-        auto& buffer = model->Buffers[view.Buffer];
+        DecodedPrimitive& decoded = decodedPrimitives[i];
+        const Primitive& primitive = *decoded.Primitive;
+        const auto& dracoMetaData = primitive.ExtensionMetaData.KHRDracoMetaData;
+        const auto& view = model->BufferViews[dracoMetaData.BufferView];
+        const auto& buffer = model->Buffers[view.Buffer];
 
         draco::DecoderBuffer decoderBuffer;
         decoderBuffer.Init(buffer.data() + view.ByteOffset, view.ByteLength);
         auto decodeResult = draco::Decoder().DecodeMeshFromBuffer(&decoderBuffer);
-        if (decodeResult.ok())
+        if (!decodeResult.ok())
         {
-          const std::unique_ptr<draco::Mesh>& mesh = decodeResult.value();
-
-          // handle index buffer
-          if (primitive.IndicesId >= 0)
-          {
-            auto& accessor = model->Accessors[primitive.IndicesId];
-
-            model->Buffers.emplace_back(::DecodeIndexBuffer(mesh, accessor.ComponentTypeValue));
-
-            vtkGLTFDocumentLoader::BufferView decodedIndexBufferView;
-            decodedIndexBufferView.Buffer = static_cast<int>(model->Buffers.size() - 1);
-            decodedIndexBufferView.ByteLength = model->Buffers.back().size();
-            decodedIndexBufferView.ByteOffset = 0;
-            decodedIndexBufferView.ByteStride = 0;
-            decodedIndexBufferView.Target =
-              static_cast<int>(vtkGLTFDocumentLoader::Target::ARRAY_BUFFER);
-            model->BufferViews.emplace_back(std::move(decodedIndexBufferView));
+          continue;
+        }
+        const std::unique_ptr<draco::Mesh>& mesh = decodeResult.value();
 
-            accessor.BufferView = static_cast<int>(model->BufferViews.size() - 1);
-            accessor.Count = static_cast<int>(mesh->num_faces() * 3);
-          }
+        if (primitive.IndicesId >= 0)
+        {
+          decoded.Indices = ::DecodeIndexBuffer(
+            mesh, model->Accessors[primitive.IndicesId].ComponentTypeValue);
+          decoded.NumberOfIndices = static_cast<int>(mesh->num_faces() * 3);
+        }
 
-          // handle vertex attributes
-          for (const auto& attrib : dracoMetaData.AttributeIndices)
+        for (const auto& attrib : dracoMetaData.AttributeIndices)
+        {
+          auto accessorIt = primitive.AttributeIndices.find(attrib.first);
+          if (accessorIt == primitive.AttributeIndices.end())
           {
-            auto& attrAccessor = model->Accessors[primitive.AttributeIndices[attrib.first]];
-
-            model->Buffers.emplace_back(
-              ::DecodeVertexBuffer(attrAccessor.ComponentTypeValue, mesh, attrib.second));
-
-            vtkGLTFDocumentLoader::BufferView decodedBufferView;
-            decodedBufferView.Buffer = static_cast<int>(model->Buffers.size() - 1);
-            decodedBufferView.ByteLength = model->Buffers.back().size();
-            decodedBufferView.ByteOffset = 0;
-            decodedBufferView.ByteStride = 0;
-            decodedBufferView.Target =
-              static_cast<int>(vtkGLTFDocumentLoader::Target::ELEMENT_ARRAY_BUFFER);
-            model->BufferViews.emplace_back(std::move(decodedBufferView));
-
-            attrAccessor.BufferView = static_cast<int>(model->BufferViews.size() - 1);
-            attrAccessor.Count = static_cast<int>(mesh->num_points());
-            attrAccessor.ByteOffset = 0;
+            continue;
           }
+          decoded.Attributes.emplace_back(accessorIt->second,
+            ::DecodeVertexBuffer(
+              model->Accessors[accessorIt->second].ComponentTypeValue, mesh, attrib.second));
         }
+        decoded.NumberOfPoints = static_cast<int>(mesh->num_points());
+        decoded.Valid = true;
       }
+    });
+
+  // Add decoded buffers to the model in primitive order
+  auto addBuffer = [&](std::vector<char>&& decodedBuffer, vtkGLTFDocumentLoader::Target target)
+  {
+    model->Buffers.emplace_back(std::move(decodedBuffer));
+
+    vtkGLTFDocumentLoader::BufferView decodedBufferView;
+    decodedBufferView.Buffer = static_cast<int>(model->Buffers.size() - 1);
+    decodedBufferView.ByteLength = model->Buffers.back().size();
+    decodedBufferView.ByteOffset = 0;
+    decodedBufferView.ByteStride = 0;
+    decodedBufferView.Target = static_cast<int>(target);
+    model->BufferViews.emplace_back(std::move(decodedBufferView));
+    return static_cast<int>(model->BufferViews.size() - 1);
+  };
+
+  for (DecodedPrimitive& decoded : decodedPrimitives)
+  {
+    if (!decoded.Valid)
+    {
+      continue;
+    }
+
+    // handle index buffer
+    if (decoded.Primitive->IndicesId >= 0)
+    {
+      auto& accessor = model->Accessors[decoded.Primitive->IndicesId];
+      accessor.BufferView =
+        addBuffer(std::move(decoded.Indices), vtkGLTFDocumentLoader::Target::ARRAY_BUFFER);
+      accessor.Count = decoded.NumberOfIndices;
+    }
+
+    // handle vertex attributes
+    for (auto& [accessorIndex, decodedBuffer] : decoded.Attributes)
+    {
+      auto& attrAccessor = model->Accessors[accessorIndex];
+      attrAccessor.BufferView = addBuffer(
+        std::move(decodedBuffer), vtkGLTFDocumentLoader::Target::ELEMENT_ARRAY_BUFFER);
+      attrAccessor.Count = decoded.NumberOfPoints;
+      attrAccessor.ByteOffset = 0;
     }
   }
 }
@@ -1,7 +1,9 @@
 void applyCustomReader(vtkAlgorithm* algo, const std::string&, vtkResourceStream*) const override
 {
-  vtkExodusIIReader* exReader = vtkExodusIIReader::SafeDownCast(algo);
-  exReader->UpdateInformation();
-  exReader->SetAllArrayStatus(vtkExodusIIReader::NODAL, 1);
-  exReader->SetAllArrayStatus(vtkExodusIIReader::ELEM_BLOCK, 1);
+  vtkF3DExodusIIReader* exReader = vtkF3DExodusIIReader::SafeDownCast(algo);
+
+  // Arrays are read on demand by default, otherwise all nodal and element block arrays are read
+  std::string optName = "ExodusII.lazy_arrays";
+  std::string str = this->ReaderOptions.at(optName);
+  exReader->SetReadArraysOnDemand(F3DUtils::ParseToDouble(str, 1, optName) != 0);
 }
@@ -0,0 +1,88 @@
+#include "vtkF3DExodusIIReader.h"
+
+#include <vtkCompositeDataIterator.h>
+#include <vtkDataSet.h>
+#include <vtkMultiBlockDataSet.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkSmartPointer.h>
+
+#include <algorithm>
+#include <iostream>
+
+namespace
+{
+vtkDataSet* GetFirstBlock(vtkF3DExodusIIReader* reader)
+{
+  reader->Update();
+  vtkMultiBlockDataSet* output = reader->GetOutput();
+  auto iter = vtkSmartPointer<vtkCompositeDataIterator>::Take(output->NewIterator());
+  iter->InitTraversal();
+  return iter->IsDoneWithTraversal() ? nullptr
+                                     : vtkDataSet::SafeDownCast(iter->GetCurrentDataObject());
+}
+}
+
+int TestF3DExodusIIReaderOnDemandArrays(int vtkNotUsed(argc), char* argv[])
+{
+  std::string filename = std::string(argv[1]) + "data/disk_out_ref.ex2";
+
+  vtkNew<vtkF3DExodusIIReader> reader;
+  reader->SetFileName(filename.c_str());
+  reader->SetReadArraysOnDemand(true);
+
+  std::vector<std::string> pointArrays = reader->GetAvailableArrays(false);
+  if (std::find(pointArrays.begin(), pointArrays.end(), "Temp") == pointArrays.end() ||
+    std::find(pointArrays.begin(), pointArrays.end(), "Pres") == pointArrays.end())
+  {
+    std::cerr << "Missing available point arrays\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkDataSet* block = ::GetFirstBlock(reader);
+  if (!block || block->GetNumberOfPoints() == 0 || block->GetPointData()->GetArray("Temp"))
+  {
+    std::cerr << "Only the geometry should be read before selecting an array\n";
+    return EXIT_FAILURE;
+  }
+
+  if (!reader->SelectArray("Temp", false) || reader->SelectArray("Temp", false))
+  {
+    std::cerr << "Unexpected selection change status\n";
+    return EXIT_FAILURE;
+  }
+
+  block = ::GetFirstBlock(reader);
+  if (!block || !block->GetPointData()->GetArray("Temp") ||
+    block->GetPointData()->GetArray("Pres"))
+  {
+    std::cerr << "Only the selected array should be read\n";
+    return EXIT_FAILURE;
+  }
+
+  // Selecting another array keeps the previously read ones
+  if (!reader->SelectArray("Pres", false) || reader->SelectArray("Unknown", false))
+  {
+    std::cerr << "Unexpected selection change status for another array\n";
+    return EXIT_FAILURE;
+  }
+
+  block = ::GetFirstBlock(reader);
+  if (!block || !block->GetPointData()->GetArray("Temp") ||
+    !block->GetPointData()->GetArray("Pres"))
+  {
+    std::cerr << "Selected arrays should be accumulated\n";
+    return EXIT_FAILURE;
+  }
+
+  reader->SetReadArraysOnDemand(false);
+  block = ::GetFirstBlock(reader);
+  if (!block || !block->GetPointData()->GetArray("Temp") ||
+    !block->GetPointData()->GetArray("Pres"))
+  {
+    std::cerr << "All arrays should be read when not reading on demand\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,88 @@
+#include "vtkF3DExodusIIReader.h"
+
+#include <vtkObjectFactory.h>
+
+#include <algorithm>
+#include <array>
+
+namespace
+{
+// Result arrays are provided as point arrays and cell arrays respectively
+constexpr std::array<int, 2> OBJECT_TYPES = { vtkExodusIIReader::NODAL,
+  vtkExodusIIReader::ELEM_BLOCK };
+}
+
+vtkStandardNewMacro(vtkF3DExodusIIReader);
+
+//----------------------------------------------------------------------------
+void vtkF3DExodusIIReader::SetReadArraysOnDemand(bool onDemand)
+{
+  if (this->ReadArraysOnDemand != onDemand)
+  {
+    this->ReadArraysOnDemand = onDemand;
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DExodusIIReader::GetReadArraysOnDemand()
+{
+  return this->ReadArraysOnDemand;
+}
+
+//----------------------------------------------------------------------------
+std::vector<std::string> vtkF3DExodusIIReader::GetAvailableArrays(bool cellData)
+{
+  this->UpdateInformation();
+
+  const int objectType = ::OBJECT_TYPES[cellData ? 1 : 0];
+  std::vector<std::string> names;
+  for (int i = 0; i < this->GetNumberOfObjectArrays(objectType); i++)
+  {
+    const char* name = this->GetObjectArrayName(objectType, i);
+    if (name)
+    {
+      names.emplace_back(name);
+    }
+  }
+  return names;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DExodusIIReader::SelectArray(const std::string& name, bool cellData)
+{
+  std::vector<std::string> names = this->GetAvailableArrays(cellData);
+  if (std::find(names.begin(), names.end(), name) == names.end() ||
+    !this->SelectedArrays.emplace(::OBJECT_TYPES[cellData ? 1 : 0], name).second)
+  {
+    return false;
+  }
+
+  this->Modified();
+  return true;
+}
+
+//----------------------------------------------------------------------------
+int vtkF3DExodusIIReader::RequestInformation(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  if (!this->Superclass::RequestInformation(request, inputVector, outputVector))
+  {
+    return 0;
+  }
+
+  for (int objectType : ::OBJECT_TYPES)
+  {
+    for (int i = 0; i < this->GetNumberOfObjectArrays(objectType); i++)
+    {
+      const char* arrayName = this->GetObjectArrayName(objectType, i);
+      const bool selected = arrayName && this->SelectedArrays.count({ objectType, arrayName }) > 0;
+      const int status = !this->ReadArraysOnDemand || selected ? 1 : 0;
+      if (this->GetObjectArrayStatus(objectType, i) != status)
+      {
+        this->SetObjectArrayStatus(objectType, i, status);
+      }
+    }
+  }
+  return 1;
+}
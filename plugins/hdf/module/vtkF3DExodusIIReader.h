@@ -0,0 +1,74 @@
+/**
+ * @class   vtkF3DExodusIIReader
+ * @brief   VTK Exodus II reader able to read its result arrays on demand
+ *
+ * Extend vtkExodusIIReader to implement F3DOnDemandArraysReader.
+ * Nodal result arrays are provided as point arrays and element block result arrays
+ * as cell arrays. When ReadArraysOnDemand is enabled, only the geometry and the selected
+ * result arrays are read, which avoids reading every variable at each time step.
+ */
+
+#ifndef vtkF3DExodusIIReader_h
+#define vtkF3DExodusIIReader_h
+
+#include "F3DOnDemandArraysReader.h"
+
+#include <vtkExodusIIReader.h>
+
+#include <set>
+#include <string>
+#include <utility>
+
+class vtkF3DExodusIIReader
+  : public vtkExodusIIReader
+  , public F3DOnDemandArraysReader
+{
+public:
+  static vtkF3DExodusIIReader* New();
+  vtkTypeMacro(vtkF3DExodusIIReader, vtkExodusIIReader);
+
+  ///@{
+  /**
+   * Set/Get if result arrays are only read once selected using SelectArray.
+   * When enabled, only the selected nodal and element block result arrays are read.
+   * When disabled, they are all read.
+   * The array status is applied when the information of the reader is updated.
+   * Default is false.
+   */
+  void SetReadArraysOnDemand(bool onDemand);
+  bool GetReadArraysOnDemand() override;
+  ///@}
+
+  /**
+   * Get the names of nodal (point) or element block (cell) result arrays.
+   */
+  std::vector<std::string> GetAvailableArrays(bool cellData) override;
+
+  /**
+   * Select a result array to read, in addition to the previously selected ones.
+   * Return true if the selection changed.
+   */
+  bool SelectArray(const std::string& name, bool cellData) override;
+
+protected:
+  vtkF3DExodusIIReader() = default;
+  ~vtkF3DExodusIIReader() override = default;
+
+  /**
+   * Apply the array status according to ReadArraysOnDemand and the selected arrays,
+   * once the arrays of the file are known.
+   */
+  int RequestInformation(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override;
+
+private:
+  vtkF3DExodusIIReader(const vtkF3DExodusIIReader&) = delete;
+  void operator=(const vtkF3DExodusIIReader&) = delete;
+
+  bool ReadArraysOnDemand = false;
+
+  // Selected arrays, by object type
+  std::set<std::pair<int, std::string>> SelectedArrays;
+};
+
+#endif
@@ -13,4 +13,8 @@ void applyCustomImporter(vtkImporter* importer, const std::string& vtkNotUsed(fi
       nullptr, "QuakeMDL.skin_index must be positive. Defaulting to 0.");
   }
   mdlImporter->SetSkinIndex(skinIndex);
+
+  optName = "QuakeMDL.interpolate_frames";
+  dsOptStr = this->ReaderOptions.at(optName);
+  mdlImporter->SetInterpolateFrames(F3DUtils::ParseToDouble(dsOptStr, 0, optName) != 0);
 }
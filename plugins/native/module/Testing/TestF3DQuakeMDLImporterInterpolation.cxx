@@ -0,0 +1,71 @@
+#include <vtkMapper.h>
+#include <vtkNew.h>
+#include <vtkPolyData.h>
+#include <vtkRenderer.h>
+#include <vtkTestUtilities.h>
+
+#include "vtkF3DQuakeMDLImporter.h"
+
+#include <cmath>
+#include <iostream>
+
+int TestF3DQuakeMDLImporterInterpolation(int vtkNotUsed(argc), char* argv[])
+{
+  std::string path = std::string(argv[1]) + "data/zombie.mdl";
+  vtkNew<vtkF3DQuakeMDLImporter> importer;
+  importer->SetFileName(path);
+  importer->Update();
+  importer->EnableAnimation(0);
+
+  vtkPolyData* mesh = vtkPolyData::SafeDownCast(
+    importer->GetRenderer()->GetActors()->GetLastActor()->GetMapper()->GetInput());
+  if (!mesh || mesh->GetNumberOfPoints() == 0)
+  {
+    std::cerr << "Invalid mesh\n";
+    return EXIT_FAILURE;
+  }
+
+  // Single frames are 10 fps
+  double first[3];
+  double second[3];
+  importer->UpdateAtTimeValue(0.0);
+  mesh->GetPoint(0, first);
+  importer->UpdateAtTimeValue(0.1);
+  mesh->GetPoint(0, second);
+
+  // Without interpolation, the first frame is displayed until the second one starts
+  importer->UpdateAtTimeValue(0.05);
+  double point[3];
+  mesh->GetPoint(0, point);
+  for (int i = 0; i < 3; i++)
+  {
+    if (point[i] != first[i])
+    {
+      std::cerr << "Unexpected point without interpolation\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  // With interpolation, the same mesh is updated halfway between the two frames
+  importer->InterpolateFramesOn();
+  importer->UpdateAtTimeValue(0.05);
+  vtkPolyData* interpolatedMesh = vtkPolyData::SafeDownCast(
+    importer->GetRenderer()->GetActors()->GetLastActor()->GetMapper()->GetInput());
+  if (interpolatedMesh != mesh)
+  {
+    std::cerr << "Mesh is not reused between frames\n";
+    return EXIT_FAILURE;
+  }
+
+  mesh->GetPoint(0, point);
+  for (int i = 0; i < 3; i++)
+  {
+    if (std::abs(point[i] - (first[i] + second[i]) / 2) > 1e-4)
+    {
+      std::cerr << "Unexpected interpolated point\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
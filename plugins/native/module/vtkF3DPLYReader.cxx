@@ -10,23 +10,309 @@
 #include <vtkNew.h>
 #include <vtkPLY.h>
 #include <vtkPointData.h>
+#include <vtkPoints.h>
 #include <vtkPolyData.h>
+#include <vtkSMPTools.h>
+#include <vtkSmartPointer.h>
 #include <vtkUnsignedCharArray.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr int NB_SH_ARRAYS = 15;
+constexpr std::array<const char*, NB_SH_ARRAYS> SH_ARRAY_NAMES = { "sh1m1", "sh10", "sh1p1",
+  "sh2m2", "sh2m1", "sh20", "sh2p1", "sh2p2", "sh3m3", "sh3m2", "sh3m1", "sh30", "sh3p1", "sh3p2",
+  "sh3p3" };
+
+//----------------------------------------------------------------------------
+unsigned char SH0ToColor(float v)
+{
+  return static_cast<unsigned char>(255.f * std::clamp(v * 0.282094791774f + 0.5f, 0.f, 1.f));
+}
+
+//----------------------------------------------------------------------------
+float Sigmoid(float v)
+{
+  return 1.f / (1.f + std::exp(-v));
+}
+
+//----------------------------------------------------------------------------
+unsigned char QuantizeOpacity(float v)
+{
+  return static_cast<unsigned char>(255.f * v);
+}
+
+//----------------------------------------------------------------------------
+unsigned char QuantizeSH(float v)
+{
+  return static_cast<unsigned char>(127.5f * (v + 1.f));
+}
+}
+
 //----------------------------------------------------------------------------
 vtkStandardNewMacro(vtkF3DPLYReader);
 
+//----------------------------------------------------------------------------
+PlyFile* vtkF3DPLYReader::OpenPLY()
+{
+  PlyFile* ply;
+  int nelems;
+  char** elist;
+
+  if (this->ReadFromInputStream)
+  {
+    // need to reset the stream position to the beginning
+    this->Stream->Seek(0, vtkResourceStream::SeekDirection::Begin);
+    ply = vtkPLY::ply_read(this->Stream, &nelems, &elist);
+  }
+  else if (this->ReadFromInputString)
+  {
+    ply = vtkPLY::ply_open_for_reading_from_string(this->InputString, &nelems, &elist);
+  }
+  else
+  {
+    ply = vtkPLY::ply_open_for_reading(this->FileName, &nelems, &elist);
+  }
+
+  if (ply)
+  {
+    // clean up unused elements
+    for (int i = 0; i < nelems; i++)
+    {
+      free(elist[i]);
+    }
+    free(elist);
+  }
+
+  return ply;
+}
+
+//----------------------------------------------------------------------------
+int vtkF3DPLYReader::RequestGaussianData(vtkPolyData* output)
+{
+#ifdef VTK_WORDS_BIGENDIAN
+  (void)output;
+  return -1;
+#else
+  PlyFile* ply = this->OpenPLY();
+  if (!ply)
+  {
+    return -1;
+  }
+
+  // Only handle binary little endian files with the vertices as the only non-empty element,
+  // so the vertex block starts right after the header and can be decoded in place
+  bool supported = ply->file_type == PLY_BINARY_LE && ply->nelems > 0 &&
+    std::strcmp(ply->elems[0]->name, "vertex") == 0;
+  for (int i = 1; supported && i < ply->nelems; i++)
+  {
+    supported = ply->elems[i]->num == 0;
+  }
+
+  // All vertex properties must be floats so a vertex is a plain array of floats
+  PlyElement* elem = supported ? ply->elems[0] : nullptr;
+  for (int i = 0; supported && i < elem->nprops; i++)
+  {
+    const PlyProperty* prop = elem->props[i];
+    supported = !prop->is_list &&
+      (prop->external_type == PLY_FLOAT || prop->external_type == PLY_FLOAT32);
+  }
+
+  auto findProperty = [&](const std::string& name)
+  {
+    int index = -1;
+    if (supported && vtkPLY::find_property(elem, name.c_str(), &index) == nullptr)
+    {
+      supported = false;
+    }
+    return index;
+  };
+
+  const std::array<int, 3> positionIds = { findProperty("x"), findProperty("y"),
+    findProperty("z") };
+  const std::array<int, 3> dcIds = { findProperty("f_dc_0"), findProperty("f_dc_1"),
+    findProperty("f_dc_2") };
+  std::array<int, 3 * NB_SH_ARRAYS> restIds;
+  for (int i = 0; i < 3 * NB_SH_ARRAYS; i++)
+  {
+    restIds[i] = findProperty("f_rest_" + std::to_string(i));
+  }
+  const int opacityId = findProperty("opacity");
+  const std::array<int, 3> scaleIds = { findProperty("scale_0"), findProperty("scale_1"),
+    findProperty("scale_2") };
+  const std::array<int, 4> rotationIds = { findProperty("rot_0"), findProperty("rot_1"),
+    findProperty("rot_2"), findProperty("rot_3") };
+
+  if (!supported)
+  {
+    vtkPLY::ply_close(ply);
+    return -1;
+  }
+
+  // Normals are optional
+  constexpr std::array<const char*, 3> normalNames = { "nx", "ny", "nz" };
+  std::array<int, 3> normalIds;
+  bool hasNormals = true;
+  for (int c = 0; c < 3; c++)
+  {
+    hasNormals =
+      hasNormals && vtkPLY::find_property(elem, normalNames[c], &normalIds[c]) != nullptr;
+  }
+
+  const vtkIdType numPts = elem->num;
+  const size_t vertexSize = static_cast<size_t>(elem->nprops);
+
+  vtkNew<vtkFloatArray> positionArray;
+  positionArray->SetNumberOfComponents(3);
+  positionArray->SetNumberOfTuples(numPts);
+
+  vtkNew<vtkFloatArray> normals;
+  if (hasNormals)
+  {
+    normals->SetName("Normals");
+    normals->SetNumberOfComponents(3);
+    normals->SetNumberOfTuples(numPts);
+  }
+
+  vtkNew<vtkUnsignedCharArray> rgb;
+  rgb->SetName("color");
+  rgb->SetNumberOfComponents(4);
+  rgb->SetNumberOfTuples(numPts);
+
+  vtkNew<vtkFloatArray> scale;
+  scale->SetName("scale");
+  scale->SetNumberOfComponents(3);
+  scale->SetNumberOfTuples(numPts);
+
+  vtkNew<vtkFloatArray> rotation;
+  rotation->SetName("rotation");
+  rotation->SetNumberOfComponents(4);
+  rotation->SetNumberOfTuples(numPts);
+
+  std::array<vtkSmartPointer<vtkUnsignedCharArray>, NB_SH_ARRAYS> shArrays;
+  std::array<unsigned char*, NB_SH_ARRAYS> shPtrs;
+  for (int i = 0; i < NB_SH_ARRAYS; i++)
+  {
+    shArrays[i] = vtkSmartPointer<vtkUnsignedCharArray>::New();
+    shArrays[i]->SetName(SH_ARRAY_NAMES[i]);
+    shArrays[i]->SetNumberOfComponents(3);
+    shArrays[i]->SetNumberOfTuples(numPts);
+    shPtrs[i] = shArrays[i]->GetPointer(0);
+  }
+
+  float* positionPtr = positionArray->GetPointer(0);
+  float* normalPtr = hasNormals ? normals->GetPointer(0) : nullptr;
+  unsigned char* rgbPtr = rgb->GetPointer(0);
+  float* scalePtr = scale->GetPointer(0);
+  float* rotationPtr = rotation->GetPointer(0);
+
+  // Read the vertex block by chunks and decode each chunk in parallel
+  constexpr vtkIdType chunkSize = 16384;
+  std::vector<float> buffer(std::min(numPts, chunkSize) * vertexSize);
+
+  for (vtkIdType chunkStart = 0; chunkStart < numPts; chunkStart += chunkSize)
+  {
+    const vtkIdType nbChunkPts = std::min(chunkSize, numPts - chunkStart);
+    const std::streamsize chunkLength =
+      static_cast<std::streamsize>(nbChunkPts * vertexSize * sizeof(float));
+    ply->is->read(reinterpret_cast<char*>(buffer.data()), chunkLength);
+    if (ply->is->gcount() != chunkLength)
+    {
+      vtkErrorMacro("Unexpected end of file while reading 3D gaussians");
+      vtkPLY::ply_close(ply);
+      return 0;
+    }
+
+    vtkSMPTools::For(0, nbChunkPts,
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType i = begin; i < end; i++)
+        {
+          const float* vertex = buffer.data() + i * vertexSize;
+          const vtkIdType j = chunkStart + i;
+
+          for (int c = 0; c < 3; c++)
+          {
+            positionPtr[3 * j + c] = vertex[positionIds[c]];
+            scalePtr[3 * j + c] = std::exp(vertex[scaleIds[c]]);
+            rgbPtr[4 * j + c] = ::SH0ToColor(vertex[dcIds[c]]);
+          }
+          rgbPtr[4 * j + 3] = ::QuantizeOpacity(::Sigmoid(vertex[opacityId]));
+
+          for (int c = 0; c < 4; c++)
+          {
+            rotationPtr[4 * j + c] = vertex[rotationIds[c]];
+          }
+
+          if (normalPtr)
+          {
+            for (int c = 0; c < 3; c++)
+            {
+              normalPtr[3 * j + c] = vertex[normalIds[c]];
+            }
+          }
+
+          // spherical harmonics are stored per channel in the file
+          for (int k = 0; k < NB_SH_ARRAYS; k++)
+          {
+            for (int c = 0; c < 3; c++)
+            {
+              shPtrs[k][3 * j + c] = ::QuantizeSH(vertex[restIds[c * NB_SH_ARRAYS + k]]);
+            }
+          }
+        }
+      });
+
+    this->UpdateProgress(static_cast<double>(chunkStart + nbChunkPts) / numPts);
+  }
+
+  vtkPLY::ply_close(ply);
+
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToFloat();
+  points->SetData(positionArray);
+  output->SetPoints(points);
+
+  if (hasNormals)
+  {
+    output->GetPointData()->SetNormals(normals);
+  }
+  output->GetPointData()->SetScalars(rgb);
+  output->GetPointData()->AddArray(scale);
+  output->GetPointData()->AddArray(rotation);
+  for (const auto& shArray : shArrays)
+  {
+    output->GetPointData()->AddArray(shArray);
+  }
+
+  return 1;
+#endif
+}
+
 //----------------------------------------------------------------------------
 int vtkF3DPLYReader::RequestData(
   vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector)
 {
+  vtkPolyData* output = vtkPolyData::GetData(outputVector);
+
+  // Try to decode 3D gaussians in a single pass first
+  int fastPathStatus = this->RequestGaussianData(output);
+  if (fastPathStatus >= 0)
+  {
+    return fastPathStatus;
+  }
+
   if (this->Superclass::RequestData(nullptr, nullptr, outputVector) == 0)
   {
     return 0;
   }
 
-  vtkPolyData* output = vtkPolyData::GetData(outputVector);
-
   if (output->GetNumberOfPolys() > 0)
   {
     // if it's not a point cloud, just early return
@@ -200,34 +486,9 @@ int vtkF3DPLYReader::RequestData(
   };
 
   // open a PLY file for reading
-  PlyFile* ply;
-  int nelems;
-  char** elist;
-
-  if (this->ReadFromInputStream)
-  {
-    // need to reset the stream position to the beginning
-    this->Stream->Seek(0, vtkResourceStream::SeekDirection::Begin);
-    ply = vtkPLY::ply_read(this->Stream, &nelems, &elist);
-  }
-  else if (this->ReadFromInputString)
-  {
-    ply = vtkPLY::ply_open_for_reading_from_string(this->InputString, &nelems, &elist);
-  }
-  else
-  {
-    ply = vtkPLY::ply_open_for_reading(this->FileName, &nelems, &elist);
-  }
-
+  PlyFile* ply = this->OpenPLY();
   assert(ply != nullptr);
 
-  // clean up unused elements
-  for (int i = 0; i < nelems; i++)
-  {
-    free(elist[i]);
-  }
-  free(elist);
-
   PlyElement* elem = vtkPLY::find_element(ply, "vertex");
 
   int numPts;
@@ -296,18 +557,11 @@ int vtkF3DPLYReader::RequestData(
   {
     vtkPLY::ply_get_element(ply, &gaussian);
 
-    auto sh0ToColor = [](float v) {
-      return static_cast<unsigned char>(255.f * std::clamp(v * 0.282094791774f + 0.5f, 0.f, 1.f));
-    };
-    auto sigmoid = [](float v) { return 1.f / (1.f + std::exp(-v)); };
-    auto quantizeOpacity = [](float v) { return static_cast<unsigned char>(255.f * v); };
-    auto quantizeSH = [](float v) { return static_cast<unsigned char>(127.5f * (v + 1.f)); };
-
     // color
-    rgb->SetTypedComponent(j, 0, sh0ToColor(gaussian.f_dc_0));
-    rgb->SetTypedComponent(j, 1, sh0ToColor(gaussian.f_dc_1));
-    rgb->SetTypedComponent(j, 2, sh0ToColor(gaussian.f_dc_2));
-    rgb->SetTypedComponent(j, 3, quantizeOpacity(sigmoid(gaussian.opacity)));
+    rgb->SetTypedComponent(j, 0, ::SH0ToColor(gaussian.f_dc_0));
+    rgb->SetTypedComponent(j, 1, ::SH0ToColor(gaussian.f_dc_1));
+    rgb->SetTypedComponent(j, 2, ::SH0ToColor(gaussian.f_dc_2));
+    rgb->SetTypedComponent(j, 3, ::QuantizeOpacity(::Sigmoid(gaussian.opacity)));
 
     // scale
     scale->SetTypedComponent(j, 0, std::exp(gaussian.scale_0));
@@ -323,9 +577,9 @@ int vtkF3DPLYReader::RequestData(
     // sherical harmonics
     auto setSHComponents = [&](vtkUnsignedCharArray* shArray, float shR, float shG, float shB)
     {
-      shArray->SetTypedComponent(j, 0, quantizeSH(shR));
-      shArray->SetTypedComponent(j, 1, quantizeSH(shG));
-      shArray->SetTypedComponent(j, 2, quantizeSH(shB));
+      shArray->SetTypedComponent(j, 0, ::QuantizeSH(shR));
+      shArray->SetTypedComponent(j, 1, ::QuantizeSH(shG));
+      shArray->SetTypedComponent(j, 2, ::QuantizeSH(shB));
     };
 
     setSHComponents(sh1m1, gaussian.f_rest_0, gaussian.f_rest_15, gaussian.f_rest_30);
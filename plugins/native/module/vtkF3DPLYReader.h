@@ -12,6 +12,9 @@
 
 #include <vtkPLYReader.h>
 
+struct PlyFile;
+class vtkPolyData;
+
 class vtkF3DPLYReader : public vtkPLYReader
 {
 public:
@@ -24,6 +27,20 @@ protected:
 
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
+  /**
+   * Decode 3D gaussians in a single pass over the vertex block.
+   * Only binary little endian files with float properties and no faces are supported.
+   * Return 1 on success, 0 on failure and -1 if the file is not supported,
+   * in which case the output is left untouched.
+   */
+  int RequestGaussianData(vtkPolyData* output);
+
+  /**
+   * Open the PLY file from the current input (stream, string or file name).
+   * Return nullptr on failure.
+   */
+  PlyFile* OpenPLY();
+
 private:
   vtkF3DPLYReader(const vtkF3DPLYReader&) = delete;
   void operator=(const vtkF3DPLYReader&) = delete;
@@ -6,6 +6,7 @@
 #include <vtkFileResourceStream.h>
 #include <vtkFloatArray.h>
 #include <vtkImageData.h>
+#include <vtkMath.h>
 #include <vtkOpenGLTexture.h>
 #include <vtkPointData.h>
 #include <vtkPolyData.h>
@@ -13,7 +14,9 @@
 #include <vtkProperty.h>
 #include <vtkRenderer.h>
 #include <vtkResourceStream.h>
+#include <vtkSMPTools.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 
@@ -268,46 +271,64 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
   }
 
   //----------------------------------------------------------------------------
-  vtkSmartPointer<vtkPolyData> CreateMeshForSimpleFrame(const mdl_simpleframe_t* frame,
-    const mdl_header_t* header, const mdl_triangle_t* triangles, vtkCellArray* cells,
-    vtkFloatArray* textureCoordinates)
+  // Decode a simple frame into the packed frame buffers and return its index
+  size_t DecodeFrame(const mdl_simpleframe_t* frame, const mdl_header_t* header)
   {
-    vtkNew<vtkPoints> vertices;
-    vertices->Allocate(header->numTriangles * 3);
-
-    vtkNew<vtkFloatArray> normals;
-    normals->SetNumberOfComponents(3);
-    normals->SetNumberOfTuples(header->numTriangles * 3);
-
-    for (int i = 0; i < header->numTriangles; i++)
+    constexpr int nbNormalVectors = sizeof(F3DMDLNormalVectors) / sizeof(F3DMDLNormalVectors[0]);
+    for (size_t i = 0; i < this->NumberOfVertices; i++)
     {
-      vtkIdType vertexNum[3];
-      for (int j = 0; j < 3; j++)
+      // Calculate real vertex position
+      for (int k = 0; k < 3; k++)
+      {
+        this->FramePositions.emplace_back(
+          frame->verts[i].xyz[k] * header->scale[k] + header->translation[k]);
+      }
+      this->FrameNormalIndices.emplace_back(
+        std::min<int>(frame->verts[i].normalIndex, nbNormalVectors - 1));
+    }
+    return this->NumberOfFrames++;
+  }
+
+  //----------------------------------------------------------------------------
+  // Update the mesh points and normals by interpolating between two decoded frames
+  void UpdateMesh(size_t frame0, size_t frame1, float weight)
+  {
+    const float* positions0 = this->FramePositions.data() + frame0 * this->NumberOfVertices * 3;
+    const float* positions1 = this->FramePositions.data() + frame1 * this->NumberOfVertices * 3;
+    const uint8_t* normals0 = this->FrameNormalIndices.data() + frame0 * this->NumberOfVertices;
+    const uint8_t* normals1 = this->FrameNormalIndices.data() + frame1 * this->NumberOfVertices;
+
+    vtkFloatArray* pointsArray = vtkFloatArray::SafeDownCast(this->Mesh->GetPoints()->GetData());
+    vtkFloatArray* normalsArray =
+      vtkFloatArray::SafeDownCast(this->Mesh->GetPointData()->GetNormals());
+    float* outPositions = pointsArray->GetPointer(0);
+    float* outNormals = normalsArray->GetPointer(0);
+
+    vtkSMPTools::For(0, static_cast<vtkIdType>(this->CornerVertices.size()),
+      [&](vtkIdType begin, vtkIdType end)
       {
-        // Recover XYZ
-        vertexNum[j] = triangles[i].vertex[j];
-        double xyz[3] = { static_cast<double>(frame->verts[vertexNum[j]].xyz[0]),
-          static_cast<double>(frame->verts[vertexNum[j]].xyz[1]),
-          static_cast<double>(frame->verts[vertexNum[j]].xyz[2]) };
-
-        // Calculate real vertex position
-        for (int k = 0; k < 3; k++)
+        for (vtkIdType i = begin; i < end; i++)
         {
-          xyz[k] = xyz[k] * header->scale[k] + header->translation[k];
+          const int vertex = this->CornerVertices[i];
+          const float* normal0 = F3DMDLNormalVectors[normals0[vertex]];
+          const float* normal1 = F3DMDLNormalVectors[normals1[vertex]];
+          for (int k = 0; k < 3; k++)
+          {
+            const float p0 = positions0[3 * vertex + k];
+            outPositions[3 * i + k] = p0 + weight * (positions1[3 * vertex + k] - p0);
+            outNormals[3 * i + k] = normal0[k] + weight * (normal1[k] - normal0[k]);
+          }
+          if (weight > 0)
+          {
+            vtkMath::Normalize(outNormals + 3 * i);
+          }
         }
-        vertices->InsertPoint(i * 3 + j, xyz);
+      });
 
-        // Normal vector
-        int normalIndex = frame->verts[vertexNum[j]].normalIndex;
-        normals->SetTypedTuple(i * 3 + j, F3DMDLNormalVectors[normalIndex]);
-      }
-    }
-    vtkNew<vtkPolyData> mesh;
-    mesh->SetPoints(vertices);
-    mesh->SetPolys(cells);
-    mesh->GetPointData()->SetTCoords(textureCoordinates);
-    mesh->GetPointData()->SetNormals(normals);
-    return mesh;
+    pointsArray->Modified();
+    normalsArray->Modified();
+    this->Mesh->GetPoints()->Modified();
+    this->Mesh->Modified();
   }
 
   //----------------------------------------------------------------------------
@@ -403,6 +424,10 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
       }
 
       // Draw cells and scale texture coordinates
+      // Vertices are duplicated for each triangle corner because of texture coordinates seams
+      this->NumberOfVertices = static_cast<size_t>(std::max(header->numVertices, 0));
+      this->CornerVertices.clear();
+      this->CornerVertices.reserve(static_cast<size_t>(std::max(header->numTriangles, 0)) * 3);
       vtkNew<vtkCellArray> cells;
       cells->AllocateExact(header->numTriangles, 3 * header->numTriangles);
       vtkNew<vtkFloatArray> textureCoordinates;
@@ -413,6 +438,12 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
       {
         for (int vertex : triangles[i].vertex)
         {
+          if (vertex < 0 || vertex >= header->numVertices)
+          {
+            throw F3DRangeError("Triangle vertex index out of range.");
+          }
+          this->CornerVertices.emplace_back(vertex);
+
           float coord_s = texcoords[vertex].coord_s;
           float coord_t = texcoords[vertex].coord_t;
           if (!triangles[i].facesFront && texcoords[vertex].onseam)
@@ -438,6 +469,30 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
         }
       }
 
+      // Reserve the packed frame buffers, all frames have the same number of vertices
+      size_t nbFrames = 0;
+      for (const plugin_frame_pointer& pluginFramePtr : framePtr)
+      {
+        nbFrames += pluginFramePtr.nb ? static_cast<size_t>(std::max(*pluginFramePtr.nb, 0)) : 1;
+      }
+      this->FramePositions.reserve(
+        this->FramePositions.size() + nbFrames * this->NumberOfVertices * 3);
+      this->FrameNormalIndices.reserve(
+        this->FrameNormalIndices.size() + nbFrames * this->NumberOfVertices);
+
+      // A single mesh is used for all frames, only points and normals are updated
+      const vtkIdType nbCorners = static_cast<vtkIdType>(this->CornerVertices.size());
+      vtkNew<vtkPoints> points;
+      points->SetNumberOfPoints(nbCorners);
+      vtkNew<vtkFloatArray> normals;
+      normals->SetNumberOfComponents(3);
+      normals->SetNumberOfTuples(nbCorners);
+      this->Mesh = vtkSmartPointer<vtkPolyData>::New();
+      this->Mesh->SetPoints(points);
+      this->Mesh->SetPolys(cells);
+      this->Mesh->GetPointData()->SetTCoords(textureCoordinates);
+      this->Mesh->GetPointData()->SetNormals(normals);
+
       // Extract animation name from frame name and recover animation index accordingly
       // Check if frame name respect standard naming scheme for single frames
       // eg: stand1, stand2, stand3, run1, run2, run3
@@ -459,7 +514,7 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
       {
         this->AnimationNames.emplace_back(animName);
         this->AnimationTimes.emplace_back(std::vector<double>());
-        this->AnimationFrames.emplace_back(std::vector<vtkSmartPointer<vtkPolyData>>());
+        this->AnimationFrames.emplace_back(std::vector<size_t>());
         return this->AnimationNames.size() - 1;
       };
 
@@ -492,17 +547,15 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
           // Single frames are 10 fps
           times.emplace_back(times.back() + 0.1);
 
-          // Create the animation frame
-          vtkSmartPointer<vtkPolyData> mesh =
-            this->CreateMeshForSimpleFrame(frame, header, triangles, cells, textureCoordinates);
-          this->AnimationFrames[singleFrameAnimIdx].emplace_back(mesh);
+          // Decode the animation frame
+          this->AnimationFrames[singleFrameAnimIdx].emplace_back(this->DecodeFrame(frame, header));
         }
         else
         {
           // Group frame are expected to be a single animation
           std::string animationName;
           std::vector<double> times;
-          std::vector<vtkSmartPointer<vtkPolyData>> meshes;
+          std::vector<size_t> frames;
 
           // groupFrames always start at 0.0
           times.emplace_back(0.0);
@@ -524,13 +577,12 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
             // Recover time for this frame from the dedicated table
             times.emplace_back(pluginFramePtr.time[groupFrameNum]);
 
-            // Recover mesh for this frame
-            meshes.emplace_back(
-              this->CreateMeshForSimpleFrame(frame, header, triangles, cells, textureCoordinates));
+            // Decode this frame
+            frames.emplace_back(this->DecodeFrame(frame, header));
           }
           this->AnimationNames.emplace_back(animationName);
           this->AnimationTimes.emplace_back(times);
-          this->AnimationFrames.emplace_back(meshes);
+          this->AnimationFrames.emplace_back(frames);
         }
 
         currentProgress++;
@@ -541,6 +593,12 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
         }
       }
 
+      if (!this->AnimationFrames.empty() && !this->AnimationFrames.front().empty())
+      {
+        const size_t firstFrame = this->AnimationFrames.front().front();
+        this->UpdateMesh(firstFrame, firstFrame, 0);
+      }
+
       currentProgress = totalProgress;
       progressRate = 1.0;
       this->Parent->InvokeEvent(vtkCommand::ProgressEvent, static_cast<void*>(&progressRate));
@@ -619,12 +677,23 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
 
   //----------------------------------------------------------------------------
   vtkF3DQuakeMDLImporter* Parent;
-  vtkSmartPointer<vtkPolyDataMapper> Mapper;
   vtkSmartPointer<vtkTexture> Texture;
 
   std::vector<std::string> AnimationNames;
   std::vector<std::vector<double>> AnimationTimes;
-  std::vector<std::vector<vtkSmartPointer<vtkPolyData>>> AnimationFrames;
+  // Indices of decoded frames in the packed frame buffers
+  std::vector<std::vector<size_t>> AnimationFrames;
+
+  // Decoded frames, packed one after the other
+  // Positions are 3 floats per vertex, normals are indices in F3DMDLNormalVectors
+  std::vector<float> FramePositions;
+  std::vector<uint8_t> FrameNormalIndices;
+  size_t NumberOfFrames = 0;
+  size_t NumberOfVertices = 0;
+
+  // Mesh displayed for all frames and the vertex of each of its points
+  vtkSmartPointer<vtkPolyData> Mesh;
+  std::vector<int> CornerVertices;
 
   std::vector<std::string> GroupSkinAnimationNames;
   std::vector<std::vector<vtkSmartPointer<vtkImageData>>> GroupSkins;
@@ -664,13 +733,12 @@ void vtkF3DQuakeMDLImporter::ImportActors(vtkRenderer* renderer)
 {
   vtkNew<vtkActor> actor;
   vtkNew<vtkPolyDataMapper> mapper;
-  mapper->SetInputData(this->Internals->AnimationFrames[0][0]);
+  mapper->SetInputData(this->Internals->Mesh);
   actor->SetMapper(mapper);
   actor->GetProperty()->SetInterpolationToPBR();
   actor->GetProperty()->SetBaseColorTexture(this->Internals->Texture);
   actor->GetProperty()->SetBaseIOR(1.0);
   renderer->AddActor(actor);
-  this->Internals->Mapper = mapper;
 
 #if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 3, 20240707)
   this->ActorCollection->AddItem(actor);
@@ -707,8 +775,17 @@ bool vtkF3DQuakeMDLImporter::UpdateAtTimeValue(double timeValue)
     const size_t frameIndex = times[i] > timeValue && i > 0 ? i - 1 : i;
     if (isMeshAnimation)
     {
-      this->Internals->Mapper->SetInputData(
-        this->Internals->AnimationFrames[animIndex][frameIndex]);
+      const std::vector<size_t>& frames = this->Internals->AnimationFrames[animIndex];
+      size_t nextFrameIndex = frameIndex;
+      float weight = 0;
+      const double duration =
+        frameIndex + 1 < times.size() ? times[frameIndex + 1] - times[frameIndex] : 0;
+      if (this->InterpolateFrames && frameIndex + 1 < frames.size() && duration > 0)
+      {
+        nextFrameIndex = frameIndex + 1;
+        weight = static_cast<float>(std::clamp((timeValue - times[frameIndex]) / duration, 0., 1.));
+      }
+      this->Internals->UpdateMesh(frames[frameIndex], frames[nextFrameIndex], weight);
     }
     else
     {
@@ -70,6 +70,17 @@ public:
   vtkGetMacro(SkinIndex, unsigned int);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get if positions and normals are interpolated between consecutive frames of a
+   * mesh animation. When disabled, the frame active at the given time value is displayed as is.
+   * Default is false.
+   */
+  vtkSetMacro(InterpolateFrames, bool);
+  vtkGetMacro(InterpolateFrames, bool);
+  vtkBooleanMacro(InterpolateFrames, bool);
+  ///@}
+
 protected:
   vtkF3DQuakeMDLImporter();
   ~vtkF3DQuakeMDLImporter() override = default;
@@ -83,6 +94,7 @@ private:
 
   struct vtkInternals;
   unsigned int SkinIndex = 0;
+  bool InterpolateFrames = false;
 
   std::unique_ptr<vtkInternals> Internals;
 };
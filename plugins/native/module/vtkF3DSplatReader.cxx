@@ -15,10 +15,15 @@
 #include <vtkPoints.h>
 #include <vtkPolyData.h>
 #include <vtkResourceStream.h>
+#include <vtkSMPTools.h>
 #include <vtkStreamingDemandDrivenPipeline.h>
 #include <vtkUnsignedCharArray.h>
 #include <vtkVersion.h>
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 //----------------------------------------------------------------------------
 vtkStandardNewMacro(vtkF3DSplatReader);
 
@@ -55,9 +60,6 @@ int vtkF3DSplatReader::RequestData(
 
   stream->Seek(0, vtkResourceStream::SeekDirection::Begin);
 
-  std::vector<unsigned char> buffer(length);
-  stream->Read(buffer.data(), length); // <-- read into buffer
-
   // position: 3 floats (12 bytes)
   // scale: 3 floats (12 bytes)
   // rotation: 4 chars (4 bytes)
@@ -68,7 +70,11 @@ int vtkF3DSplatReader::RequestData(
   constexpr size_t colorOffset = 24;
   constexpr size_t rotationOffset = 28;
 
-  size_t nbSplats = buffer.size() / splatSize;
+  // The file is decoded by chunks straight into the output arrays
+  // so it is never held entirely in memory next to them
+  constexpr size_t chunkSize = 16384;
+
+  size_t nbSplats = length / splatSize;
 
   vtkNew<vtkFloatArray> positionArray;
   positionArray->SetNumberOfComponents(3);
@@ -90,21 +96,44 @@ int vtkF3DSplatReader::RequestData(
   rotationArray->SetNumberOfTuples(nbSplats);
   rotationArray->SetName("rotation");
 
-  for (size_t i = 0; i < nbSplats; i++)
-  {
-    float* position = reinterpret_cast<float*>(buffer.data() + (splatSize * i) + positionOffset);
-    float* scale = reinterpret_cast<float*>(buffer.data() + (splatSize * i) + scaleOffset);
-    unsigned char* rotation = buffer.data() + (splatSize * i) + rotationOffset;
-    unsigned char* color = buffer.data() + (splatSize * i) + colorOffset;
+  float* positions = positionArray->GetPointer(0);
+  float* scales = scaleArray->GetPointer(0);
+  unsigned char* colors = colorArray->GetPointer(0);
+  float* rotations = rotationArray->GetPointer(0);
 
-    positionArray->SetTypedTuple(i, position);
-    scaleArray->SetTypedTuple(i, scale);
-    colorArray->SetTypedTuple(i, color);
+  std::vector<unsigned char> buffer(std::min(nbSplats, chunkSize) * splatSize);
 
-    for (int c = 0; c < 4; c++)
+  for (size_t chunkStart = 0; chunkStart < nbSplats; chunkStart += chunkSize)
+  {
+    size_t nbChunkSplats = std::min(chunkSize, nbSplats - chunkStart);
+    size_t chunkLength = nbChunkSplats * splatSize;
+    if (stream->Read(buffer.data(), chunkLength) != chunkLength)
     {
-      rotationArray->SetTypedComponent(i, c, (static_cast<float>(rotation[c]) - 128.f) / 128.f);
+      vtkErrorMacro("Unexpected end of stream while reading splats");
+      return 0;
     }
+
+    vtkSMPTools::For(0, static_cast<vtkIdType>(nbChunkSplats),
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType i = begin; i < end; i++)
+        {
+          const unsigned char* splat = buffer.data() + splatSize * i;
+          const size_t id = chunkStart + i;
+
+          std::memcpy(positions + 3 * id, splat + positionOffset, 3 * sizeof(float));
+          std::memcpy(scales + 3 * id, splat + scaleOffset, 3 * sizeof(float));
+          std::memcpy(colors + 4 * id, splat + colorOffset, 4);
+
+          const unsigned char* rotation = splat + rotationOffset;
+          for (int c = 0; c < 4; c++)
+          {
+            rotations[4 * id + c] = (static_cast<float>(rotation[c]) - 128.f) / 128.f;
+          }
+        }
+      });
+
+    this->UpdateProgress(static_cast<double>(chunkStart + nbChunkSplats) / nbSplats);
   }
 
   vtkNew<vtkPoints> points;
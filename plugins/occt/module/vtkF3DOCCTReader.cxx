@@ -55,6 +55,7 @@
 #include <vtkCommand.h>
 #include <vtkDemandDrivenPipeline.h>
 #include <vtkFloatArray.h>
+#include <vtkIdTypeArray.h>
 #include <vtkInformation.h>
 #include <vtkInformationVector.h>
 #include <vtkMatrix4x4.h>
@@ -64,15 +65,19 @@
 #include <vtkPoints.h>
 #include <vtkPolyData.h>
 #include <vtkResourceStream.h>
+#include <vtkSMPTools.h>
 #include <vtkTransform.h>
 #include <vtkTransformFilter.h>
 #include <vtkUnsignedCharArray.h>
 #include <vtkUnsignedIntArray.h>
 #include <vtksys/SystemTools.hxx>
 
+#include <algorithm>
 #include <array>
+#include <cassert>
 #include <numeric>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 vtkCxxSetSmartPointerMacro(vtkF3DOCCTReader, Stream, vtkResourceStream);
@@ -196,113 +201,167 @@ public:
       }
     }
 
-    // Add all faces to polydata
+    // Collect all faces with a triangulation and compute their offsets in the output arrays.
+    // A triangulation is shared between faces that only differ in location,
+    // so normals are computed only once per triangulation.
+    struct FaceData
+    {
+      TopAbs_Orientation Orientation;
+      TopLoc_Location Location;
+      Handle(Poly_Triangulation) Triangulation;
+      vtkIdType PointOffset;
+      vtkIdType TriangleOffset;
+#if F3D_PLUGIN_OCCT_XCAF
+      std::array<unsigned char, 3> RGB = { 255, 255, 255 };
+#endif
+    };
+    std::vector<FaceData> faces;
+    std::unordered_set<const Poly_Triangulation*> triangulations;
+    vtkIdType nbFacesPoints = 0;
+    vtkIdType nbFacesTriangles = 0;
     for (TopExp_Explorer exFace(shape, TopAbs_FACE); exFace.More(); exFace.Next())
     {
       TopoDS_Face face = TopoDS::Face(exFace.Current());
 
-      TopLoc_Location location;
-      const auto& poly = BRep_Tool::Triangulation(face, location);
-
-      if (poly.IsNull())
+      FaceData faceData;
+      faceData.Triangulation = BRep_Tool::Triangulation(face, faceData.Location);
+      if (faceData.Triangulation.IsNull())
       {
         continue;
       }
 
-      Poly::ComputeNormals(poly);
-      TopAbs_Orientation faceOrientation = face.Orientation();
-
-      Standard_Integer nbT = poly->NbTriangles();
-      Standard_Integer nbV = poly->NbNodes();
-
-      // Points
-      for (Standard_Integer i = 1; i <= nbV; i++)
+      if (triangulations.insert(faceData.Triangulation.get()).second)
       {
-        gp_Pnt pt = poly->Node(i).Transformed(location);
-        points->InsertNextPoint(pt.X(), pt.Y(), pt.Z());
+        Poly::ComputeNormals(faceData.Triangulation);
       }
 
-      // Normals
-      if (poly->HasNormals())
-      {
-        for (Standard_Integer i = 1; i <= nbV; i++)
-        {
-          gp_Dir n = poly->Normal(i);
-          float fn[3] = { static_cast<float>(n.X()), static_cast<float>(n.Y()),
-            static_cast<float>(n.Z()) };
-          if (faceOrientation == TopAbs_Orientation::TopAbs_REVERSED)
-          {
-            vtkMath::MultiplyScalar(fn, -1.f);
-          }
-          normals->InsertNextTypedTuple(fn);
-        }
-      }
-      else
-      {
-        // just in case a face does not have normals, add a dummy normal
-        float fn[3] = { 0.0, 0.0, 1.0 };
-        for (Standard_Integer i = 1; i <= nbV; i++)
-        {
-          normals->InsertNextTypedTuple(fn);
-        }
-      }
-
-      // UVs
-      if (poly->HasUVNodes())
-      {
-        for (Standard_Integer i = 1; i <= nbV; i++)
-        {
-          gp_Pnt2d uv = poly->UVNode(i);
-          float fn[2] = { static_cast<float>(uv.X()), static_cast<float>(uv.Y()) };
-          uvs->InsertNextTypedTuple(fn);
-        }
-      }
-      else
-      {
-        uvs->SetNumberOfTuples(nbV);
-        uvs->Fill(0.0);
-      }
-
-      for (int i = 1; i <= nbT; i++)
-      {
-        int n1, n2, n3;
-        poly->Triangle(i).Get(n1, n2, n3);
-
-        vtkIdType cell[3] = { shift + n1 - 1, shift + n2 - 1, shift + n3 - 1 };
-        if (faceOrientation != TopAbs_Orientation::TopAbs_FORWARD)
-        {
-          std::swap(cell[0], cell[2]);
-        }
-        trianglesCells->InsertNextCell(3, cell);
-      }
+      faceData.Orientation = face.Orientation();
+      faceData.PointOffset = shift + nbFacesPoints;
+      faceData.TriangleOffset = nbFacesTriangles;
+      nbFacesPoints += faceData.Triangulation->NbNodes();
+      nbFacesTriangles += faceData.Triangulation->NbTriangles();
 
 #if F3D_PLUGIN_OCCT_XCAF
-      std::array<unsigned char, 3> rgb = { 255, 255, 255 };
       try
       {
         const auto& style = inheritedStyles.FindFromKey(face);
         if (style.IsSetColorSurf())
         {
           Quantity_Color color = style.GetColorSurf();
-          rgb[0] = static_cast<unsigned char>(255.0 * color.Red());
-          rgb[1] = static_cast<unsigned char>(255.0 * color.Green());
-          rgb[2] = static_cast<unsigned char>(255.0 * color.Blue());
+          faceData.RGB[0] = static_cast<unsigned char>(255.0 * color.Red());
+          faceData.RGB[1] = static_cast<unsigned char>(255.0 * color.Green());
+          faceData.RGB[2] = static_cast<unsigned char>(255.0 * color.Blue());
         }
       }
       catch (Standard_NoSuchObject&)
       {
         /* face has no style, safe to ignore */
       }
-
-      for (int i = 1; i <= nbT; i++)
-      {
-        colors->InsertNextTypedTuple(rgb.data());
-      }
 #endif
 
-      shift += nbV;
+      faces.emplace_back(std::move(faceData));
     }
 
+    // Allocate the output arrays once, after the edges if any
+    const vtkIdType nbPoints = shift + nbFacesPoints;
+    points->SetNumberOfPoints(nbPoints);
+    normals->SetNumberOfTuples(nbPoints);
+    uvs->SetNumberOfTuples(nbPoints);
+
+    vtkNew<vtkIdTypeArray> offsets;
+    offsets->SetNumberOfValues(nbFacesTriangles + 1);
+    vtkNew<vtkIdTypeArray> connectivity;
+    connectivity->SetNumberOfValues(3 * nbFacesTriangles);
+
+    vtkFloatArray* pointsArray = vtkFloatArray::SafeDownCast(points->GetData());
+    assert(pointsArray);
+    float* pointsPtr = pointsArray->GetPointer(0);
+    float* normalsPtr = normals->GetPointer(0);
+    float* uvsPtr = uvs->GetPointer(0);
+    vtkIdType* offsetsPtr = offsets->GetPointer(0);
+    vtkIdType* connectivityPtr = connectivity->GetPointer(0);
+
+#if F3D_PLUGIN_OCCT_XCAF
+    const vtkIdType nbLines = colors->GetNumberOfTuples();
+    colors->SetNumberOfTuples(nbLines + nbFacesTriangles);
+    unsigned char* colorsPtr = colors->GetPointer(3 * nbLines);
+#endif
+
+    // Add all faces to polydata, each face writing in its own range of the arrays
+    vtkSMPTools::For(0, static_cast<vtkIdType>(faces.size()),
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType iFace = begin; iFace < end; iFace++)
+        {
+          const FaceData& faceData = faces[iFace];
+          const Handle(Poly_Triangulation)& poly = faceData.Triangulation;
+          const bool reversed = faceData.Orientation == TopAbs_Orientation::TopAbs_REVERSED;
+          const bool hasNormals = poly->HasNormals();
+          const bool hasUVs = poly->HasUVNodes();
+
+          Standard_Integer nbT = poly->NbTriangles();
+          Standard_Integer nbV = poly->NbNodes();
+
+          for (Standard_Integer i = 1; i <= nbV; i++)
+          {
+            const vtkIdType pointId = faceData.PointOffset + i - 1;
+
+            // Points
+            gp_Pnt pt = poly->Node(i).Transformed(faceData.Location);
+            pointsPtr[3 * pointId + 0] = static_cast<float>(pt.X());
+            pointsPtr[3 * pointId + 1] = static_cast<float>(pt.Y());
+            pointsPtr[3 * pointId + 2] = static_cast<float>(pt.Z());
+
+            // Normals, just in case a face does not have normals, add a dummy normal
+            float fn[3] = { 0.0, 0.0, 1.0 };
+            if (hasNormals)
+            {
+              gp_Dir n = poly->Normal(i);
+              fn[0] = static_cast<float>(n.X());
+              fn[1] = static_cast<float>(n.Y());
+              fn[2] = static_cast<float>(n.Z());
+              if (reversed)
+              {
+                vtkMath::MultiplyScalar(fn, -1.f);
+              }
+            }
+            std::copy_n(fn, 3, normalsPtr + 3 * pointId);
+
+            // UVs
+            float uv[2] = { 0.0, 0.0 };
+            if (hasUVs)
+            {
+              gp_Pnt2d uvNode = poly->UVNode(i);
+              uv[0] = static_cast<float>(uvNode.X());
+              uv[1] = static_cast<float>(uvNode.Y());
+            }
+            std::copy_n(uv, 2, uvsPtr + 2 * pointId);
+          }
+
+          for (Standard_Integer i = 1; i <= nbT; i++)
+          {
+            int n1, n2, n3;
+            poly->Triangle(i).Get(n1, n2, n3);
+
+            vtkIdType cell[3] = { faceData.PointOffset + n1 - 1, faceData.PointOffset + n2 - 1,
+              faceData.PointOffset + n3 - 1 };
+            if (faceData.Orientation != TopAbs_Orientation::TopAbs_FORWARD)
+            {
+              std::swap(cell[0], cell[2]);
+            }
+
+            const vtkIdType cellId = faceData.TriangleOffset + i - 1;
+            std::copy_n(cell, 3, connectivityPtr + 3 * cellId);
+            offsetsPtr[cellId] = 3 * cellId;
+#if F3D_PLUGIN_OCCT_XCAF
+            std::copy_n(faceData.RGB.data(), 3, colorsPtr + 3 * cellId);
+#endif
+          }
+        }
+      });
+    offsetsPtr[nbFacesTriangles] = 3 * nbFacesTriangles;
+    trianglesCells->SetData(offsets, connectivity);
+
     vtkNew<vtkPolyData> polydata;
     polydata->SetPoints(points);
     polydata->GetPointData()->SetNormals(normals);
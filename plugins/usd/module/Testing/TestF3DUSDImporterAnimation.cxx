@@ -0,0 +1,50 @@
+#include "vtkF3DUSDImporter.h"
+
+#include <vtkActor.h>
+#include <vtkActorCollection.h>
+#include <vtkNew.h>
+#include <vtkRenderer.h>
+#include <vtkTestUtilities.h>
+
+#include <algorithm>
+#include <iostream>
+
+int TestF3DUSDImporterAnimation(int vtkNotUsed(argc), char* argv[])
+{
+  std::string filename = std::string(argv[1]) + "data/AnimatedCube.usdz";
+  vtkNew<vtkF3DUSDImporter> importer;
+  importer->SetFileName(filename.c_str());
+  importer->EnableAnimation(0);
+  importer->Update();
+
+  vtkActorCollection* actors = importer->GetRenderer()->GetActors();
+  const int nbActors = actors->GetNumberOfItems();
+  vtkActor* actor = vtkActor::SafeDownCast(actors->GetItemAsObject(0));
+  if (nbActors == 0 || !actor)
+  {
+    std::cerr << "No actor imported\n";
+    return EXIT_FAILURE;
+  }
+
+  double initialBounds[6];
+  actor->GetBounds(initialBounds);
+
+  importer->UpdateAtTimeValue(0.3);
+
+  // existing actors are updated in place
+  if (actors->GetNumberOfItems() != nbActors || actors->GetItemAsObject(0) != actor)
+  {
+    std::cerr << "Actors were recreated by the animation update\n";
+    return EXIT_FAILURE;
+  }
+
+  double bounds[6];
+  actor->GetBounds(bounds);
+  if (std::equal(bounds, bounds + 6, initialBounds))
+  {
+    std::cerr << "Animated actor was not updated\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
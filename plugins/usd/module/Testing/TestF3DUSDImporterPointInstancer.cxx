@@ -0,0 +1,122 @@
+#include "vtkF3DUSDImporter.h"
+
+#include <vtkActor.h>
+#include <vtkActorCollection.h>
+#include <vtkBoundingBox.h>
+#include <vtkDataArray.h>
+#include <vtkGlyph3DMapper.h>
+#include <vtkMatrix4x4.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPolyData.h>
+#include <vtkQuaternion.h>
+#include <vtkRenderer.h>
+
+#include <array>
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+/**
+ * Add the world bounds of each instance drawn by a glyph mapper to the bounding box,
+ * the bounds of the glyph mapper are too loose when glyphs are oriented
+ */
+vtkIdType AddInstancesBounds(vtkActor* actor, vtkGlyph3DMapper* mapper, vtkBoundingBox& bbox)
+{
+  vtkPolyData* instances = vtkPolyData::SafeDownCast(mapper->GetInputDataObject(0, 0));
+  vtkPolyData* source = mapper->GetSource();
+  vtkDataArray* orientations = instances->GetPointData()->GetArray("Orientation");
+  vtkDataArray* scales = instances->GetPointData()->GetArray("Scale");
+
+  for (vtkIdType i = 0; i < instances->GetNumberOfPoints(); i++)
+  {
+    double position[3];
+    instances->GetPoint(i, position);
+    const double* scale = scales->GetTuple3(i);
+    const double* q = orientations->GetTuple4(i);
+    vtkQuaterniond quaternion(q[0], q[1], q[2], q[3]);
+    quaternion.Normalize();
+    double rotation[3][3];
+    quaternion.ToMatrix3x3(rotation);
+
+    // Scale, then rotate, then translate each point of the glyph, then apply the actor matrix
+    vtkNew<vtkMatrix4x4> instanceMatrix;
+    for (int r = 0; r < 3; r++)
+    {
+      for (int c = 0; c < 3; c++)
+      {
+        instanceMatrix->SetElement(r, c, rotation[r][c] * scale[c]);
+      }
+      instanceMatrix->SetElement(r, 3, position[r]);
+    }
+    vtkMatrix4x4::Multiply4x4(actor->GetMatrix(), instanceMatrix, instanceMatrix);
+
+    for (vtkIdType p = 0; p < source->GetNumberOfPoints(); p++)
+    {
+      std::array<double, 4> point = { 0, 0, 0, 1 };
+      source->GetPoint(p, point.data());
+      instanceMatrix->MultiplyPoint(point.data(), point.data());
+      bbox.AddPoint(point.data());
+    }
+  }
+  return instances->GetNumberOfPoints();
+}
+}
+
+int TestF3DUSDImporterPointInstancer(int vtkNotUsed(argc), char* argv[])
+{
+  std::string filename = std::string(argv[1]) + "data/point_instancer.usda";
+  vtkNew<vtkF3DUSDImporter> importer;
+  importer->SetFileName(filename.c_str());
+  importer->Update();
+  if (!importer->GetRenderer())
+  {
+    std::cerr << "Failed to import " << filename << "\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkActorCollection* actors = importer->GetRenderer()->GetActors();
+  if (actors->GetNumberOfItems() != 2)
+  {
+    std::cerr << "Expected one actor per prototype, got " << actors->GetNumberOfItems() << "\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkBoundingBox bbox;
+  vtkIdType instanceCount = 0;
+  actors->InitTraversal();
+  while (vtkActor* actor = actors->GetNextActor())
+  {
+    vtkGlyph3DMapper* mapper = vtkGlyph3DMapper::SafeDownCast(actor->GetMapper());
+    if (!mapper)
+    {
+      std::cerr << "Prototypes should be drawn with a glyph mapper\n";
+      return EXIT_FAILURE;
+    }
+    instanceCount += ::AddInstancesBounds(actor, mapper, bbox);
+  }
+
+  if (instanceCount != 3)
+  {
+    std::cerr << "Expected 3 instances, got " << instanceCount << "\n";
+    return EXIT_FAILURE;
+  }
+
+  // Prototype transforms, then instance transforms, then the transform of the instancer parent
+  constexpr std::array<double, 6> expected = { 8, 21, -2, 12, -2, 2 };
+  std::array<double, 6> bounds;
+  bbox.GetBounds(bounds.data());
+  for (int i = 0; i < 6; i++)
+  {
+    // Orientations are stored as half precision quaternions
+    if (std::abs(bounds[i] - expected[i]) > 1e-2)
+    {
+      std::cerr << "Unexpected bounds: " << bounds[0] << ", " << bounds[1] << ", " << bounds[2]
+                << ", " << bounds[3] << ", " << bounds[4] << ", " << bounds[5] << "\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -1,5 +1,6 @@
 #include "vtkF3DUSDImporter.h"
 
+#include "F3DTextureDecoder.h"
 #include "vtkF3DFaceVaryingPointDispatcher.h"
 
 #include <vtkActor.h>
@@ -8,6 +9,7 @@
 #include <vtkCylinderSource.h>
 #include <vtkDoubleArray.h>
 #include <vtkFloatArray.h>
+#include <vtkGlyph3DMapper.h>
 #include <vtkImageAppendComponents.h>
 #include <vtkImageData.h>
 #include <vtkImageExtractComponents.h>
@@ -56,6 +58,7 @@
 #elif defined(_MSC_VER)
 #pragma warning(push, 0)
 #endif
+#include <pxr/base/gf/transform.h>
 #include <pxr/usd/ar/asset.h>
 #include <pxr/usd/ar/resolver.h>
 #include <pxr/usd/usd/modelAPI.h>
@@ -73,6 +76,7 @@
 #include <pxr/usd/usdGeom/sphere.h>
 #include <pxr/usd/usdGeom/tokens.h>
 #include <pxr/usd/usdGeom/xform.h>
+#include <pxr/usd/usdGeom/xformCache.h>
 #include <pxr/usd/usdShade/material.h>
 #include <pxr/usd/usdShade/materialBindingAPI.h>
 #include <pxr/usd/usdSkel/bakeSkinning.h>
@@ -95,6 +99,11 @@ public:
 
   ~vtkInternals()
   {
+    // images still being decoded read from buffers owned by this class
+    for (const auto& [path, pending] : this->PendingImages)
+    {
+      pending.Image.wait();
+    }
     pxr::TfDiagnosticMgr::GetInstance().RemoveDelegate(&this->Delegate);
   }
 
@@ -136,6 +145,21 @@ public:
     return { pxr::UsdShadeShader(), pxr::TfToken() };
   }
 
+  /**
+   * Instances of a point instancer prototype, rendered with a glyph mapper
+   */
+  struct InstancingInfo
+  {
+    // instances positions with "Orientation" (quaternion) and "Scale" point data
+    vtkSmartPointer<vtkPolyData> Instances;
+
+    // instancer to world transform
+    vtkSmartPointer<vtkMatrix4x4> InstancerMatrix;
+
+    // world to prototype parent transform
+    vtkSmartPointer<vtkMatrix4x4> PrototypeParentInverse;
+  };
+
   vtkSmartPointer<vtkMatrix4x4> ConvertMatrix(const pxr::GfMatrix4d& uMatrix)
   {
     vtkNew<vtkMatrix4x4> mat;
@@ -153,8 +177,9 @@ public:
     return this->ConvertMatrix(node.ComputeLocalToWorldTransform(timeCode));
   }
 
-  void AddActor(vtkRenderer* renderer, const pxr::SdfPath& path, const pxr::UsdGeomGprim& geomPrim,
-    const pxr::UsdPrim& prim, vtkMatrix4x4* mat, vtkPolyData* polydata)
+  vtkActor* AddActor(vtkRenderer* renderer, const pxr::SdfPath& path,
+    const pxr::UsdGeomGprim& geomPrim, const pxr::UsdPrim& prim, vtkMatrix4x4* mat,
+    vtkPolyData* polydata, vtkPolyData* instances = nullptr)
   {
     pxr::SdfPath actorPath = path.AppendChild(pxr::TfToken(prim.GetName()));
 
@@ -239,8 +264,14 @@ public:
       renderer->AddActor(actor);
     }
 
-    // set mapper
-    vtkNew<vtkPolyDataMapper> mapper;
+    this->UpdateMapper(actor, polydata, instances);
+    actor->SetUserMatrix(mat);
+    return actor;
+  }
+
+  void UpdateMapper(vtkActor* actor, vtkPolyData* polydata, vtkPolyData* instances)
+  {
+    vtkSmartPointer<vtkPolyData> surface = polydata;
 
     if (actor->GetProperty()->GetTexture("normalTex"))
     {
@@ -253,11 +284,34 @@ public:
       vtkNew<vtkPolyDataTangents> tangents;
       tangents->SetInputConnection(normals->GetOutputPort());
       tangents->Update();
-      mapper->SetInputData(tangents->GetOutput());
+      surface = tangents->GetOutput();
+    }
+
+    vtkPolyDataMapper* existingMapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
+    if (!instances && existingMapper)
+    {
+      existingMapper->SetInputData(surface);
+      return;
+    }
+
+    vtkSmartPointer<vtkMapper> mapper;
+    if (instances)
+    {
+      // draw all instances of the surface at once, see ImportPointInstancer
+      vtkNew<vtkGlyph3DMapper> glyphMapper;
+      glyphMapper->SetInputData(instances);
+      glyphMapper->SetSourceData(surface);
+      glyphMapper->SetOrientationArray("Orientation");
+      glyphMapper->SetOrientationModeToQuaternion();
+      glyphMapper->SetScaleArray("Scale");
+      glyphMapper->SetScaleModeToScaleByVectorComponents();
+      mapper = glyphMapper;
     }
     else
     {
-      mapper->SetInputData(polydata);
+      vtkNew<vtkPolyDataMapper> polyDataMapper;
+      polyDataMapper->SetInputData(surface);
+      mapper = polyDataMapper;
     }
 
     if (!this->HasTimeCode())
@@ -266,458 +320,598 @@ public:
     }
 
     actor->SetMapper(mapper);
-    actor->SetUserMatrix(mat);
   }
 
-  void ImportNode(vtkRenderer* renderer, const pxr::UsdPrim& node, const pxr::SdfPath& path,
-    vtkMatrix4x4* currentMatrix)
+  vtkSmartPointer<vtkPolyData> CreatePolyData(const pxr::UsdPrim& prim, pxr::UsdTimeCode timeCode)
   {
-    pxr::UsdTimeCode timeCode = this->CurrentTime * this->Stage->GetTimeCodesPerSecond();
+    vtkSmartPointer<vtkPolyData> polydata;
 
-    // simple range-for iteration
-    for (pxr::UsdPrim prim : pxr::UsdPrimSiblingRange(node.GetAllChildren()))
+    if (prim.IsA<pxr::UsdGeomMesh>())
     {
-      if (prim.IsA<pxr::UsdGeomImageable>())
+      pxr::UsdGeomMesh meshPrim = pxr::UsdGeomMesh(prim);
+
+      vtkSmartPointer<vtkPolyData>& mappedPolydata =
+        this->MeshMap[meshPrim.GetPath().GetAsString()];
+      bool meshAlreadyExists = (mappedPolydata != nullptr);
+
+      // attributes
+      pxr::UsdAttribute normalsAttr = meshPrim.GetNormalsAttr();
+      pxr::UsdAttribute pointsAttr = meshPrim.GetPointsAttr();
+      pxr::UsdAttribute facesCountAttr = meshPrim.GetFaceVertexCountsAttr();
+      pxr::UsdAttribute facesIndicesAttr = meshPrim.GetFaceVertexIndicesAttr();
+
+      std::vector<pxr::UsdGeomPrimvar> primVars = pxr::UsdGeomPrimvarsAPI(meshPrim).GetPrimvars();
+
+      auto TimeVarying = [](const auto& a) { return a.ValueMightBeTimeVarying(); };
+
+      bool animatedAttribute = std::any_of(primVars.cbegin(), primVars.cend(), TimeVarying);
+      animatedAttribute = animatedAttribute || TimeVarying(pointsAttr);
+      animatedAttribute = animatedAttribute || TimeVarying(normalsAttr);
+      animatedAttribute = animatedAttribute || TimeVarying(facesCountAttr);
+      animatedAttribute = animatedAttribute || TimeVarying(facesIndicesAttr);
+
+      // Check if the mesh has to be rebuilt
+      if (!meshAlreadyExists || animatedAttribute)
       {
-        pxr::UsdGeomImageable imageable = pxr::UsdGeomImageable(prim);
+        vtkNew<vtkPolyData> newPolyData;
 
-        pxr::TfToken visibility;
-        pxr::UsdAttribute visAttr = imageable.GetVisibilityAttr();
-        if (visAttr && visAttr.HasAuthoredValue() && visAttr.Get(&visibility, timeCode) &&
-          visibility == pxr::UsdGeomTokens->invisible)
+        // normals
+        pxr::VtArray<pxr::GfVec3f> normals;
+        normalsAttr.Get(&normals, timeCode);
+
+        if (normals.size() > 0)
         {
-          // not visible, skip
-          continue;
+          vtkNew<vtkFloatArray> vNormals;
+          vNormals->SetName("Normals");
+          vNormals->SetNumberOfComponents(3);
+          vNormals->Allocate(normals.size());
+
+          for (const pxr::GfVec3f& n : normals)
+          {
+            vNormals->InsertNextTuple3(n[0], n[1], n[2]);
+          }
+
+          vtkInformation* info = vNormals->GetInformation();
+          info->Set(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE(),
+            meshPrim.GetNormalsInterpolation() == pxr::UsdGeomTokens->faceVarying ? 1 : 0);
+
+          newPolyData->GetPointData()->SetNormals(vNormals);
         }
 
-        pxr::TfToken purpose;
-        pxr::UsdAttribute purpAttr = imageable.GetPurposeAttr();
-        if (purpAttr && purpAttr.HasAuthoredValue() && purpAttr.Get(&purpose, timeCode) &&
-          (purpose == pxr::UsdGeomTokens->proxy || purpose == pxr::UsdGeomTokens->guide))
+        // texture coordinates
+        bool firstArray = true;
+        for (const pxr::UsdGeomPrimvar& primVar : primVars)
         {
-          // proxy, skip
-          continue;
-        }
-      }
+          if (primVar.GetTypeName() == "texCoord2f[]" || primVar.GetTypeName() == "float2[]")
+          {
+            pxr::VtArray<pxr::GfVec2f> uvs;
+            primVar.Get(&uvs, timeCode);
 
-      if (prim.IsInstance())
-      {
-        pxr::UsdGeomXform xform = pxr::UsdGeomXform(prim);
+            if (uvs.size() > 0)
+            {
+              std::string name = primVar.GetPrimvarName();
 
-        auto mat = this->GetLocalTransform(xform, timeCode);
-        vtkMatrix4x4::Multiply4x4(currentMatrix, mat, mat);
+              vtkNew<vtkFloatArray> texCoords;
+              texCoords->SetName(name.c_str());
+              texCoords->SetNumberOfComponents(2);
 
-        this->ImportNode(renderer, prim.GetPrototype(), path.AppendChild(prim.GetName()), mat);
-      }
-      else if (prim.IsA<pxr::UsdGeomPointInstancer>())
-      {
-        pxr::UsdGeomPointInstancer glyphs = pxr::UsdGeomPointInstancer(prim);
+              if (primVar.IsIndexed())
+              {
+                pxr::UsdAttribute indicesAttr = primVar.GetIndicesAttr();
+
+                pxr::VtArray<int> indices;
+                if (indicesAttr.Get(&indices) && indices.size() > 0)
+                {
+                  texCoords->Allocate(indices.size());
 
-        // TODO: Ideally, we should use the 3D glyph mapper, but it's left for future work
-        // See https://github.com/f3d-app/f3d/issues/1075
-        pxr::VtMatrix4dArray xforms;
+                  for (int index : indices)
+                  {
+                    const pxr::GfVec2f& uv = uvs[index];
+                    texCoords->InsertNextTuple2(uv[0], uv[1]);
+                  }
+                }
+              }
+              else
+              {
+                texCoords->Allocate(uvs.size());
 
-        if (glyphs.ComputeInstanceTransformsAtTime(&xforms, timeCode, timeCode))
-        {
-          int i = 0;
-          for (const pxr::GfMatrix4d& currInstMatrix : xforms)
-          {
-            auto mat = this->ConvertMatrix(currInstMatrix);
-            vtkMatrix4x4::Multiply4x4(currentMatrix, mat, mat);
+                for (const pxr::GfVec2f& uv : uvs)
+                {
+                  texCoords->InsertNextTuple2(uv[0], uv[1]);
+                }
+              }
 
-            pxr::TfToken tok(std::string("instance_") + std::to_string(i++));
+              vtkInformation* info = texCoords->GetInformation();
+              info->Set(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE(),
+                primVar.GetInterpolation() == pxr::UsdGeomTokens->faceVarying ? 1 : 0);
+
+              // the size of the array can be larger than the number of points if the attribute
+              // interpolation is face-varying.
+              // It will be normalized by the vtkF3DFaceVaryingPointDispatcher later
+              newPolyData->GetPointData()->AddArray(texCoords);
 
-            this->ImportNode(
-              renderer, prim, path.AppendChild(prim.GetName()).AppendChild(tok), mat);
+              if (firstArray)
+              {
+                // sometimes we are enable to fetch the array name to use for texture mapping
+                // so we fallback to the first UV set added
+                // see https://github.com/f3d-app/f3d/issues/1184
+                firstArray = false;
+                newPolyData->GetPointData()->SetTCoords(texCoords);
+              }
+            }
           }
         }
-      }
-      else if (prim.IsA<pxr::UsdGeomGprim>())
-      {
-        pxr::UsdGeomGprim geomPrim = pxr::UsdGeomGprim(prim);
 
-        vtkSmartPointer<vtkPolyData> polydata;
+        // points
+        pxr::VtArray<pxr::GfVec3f> positions;
+        pointsAttr.Get(&positions, timeCode);
 
-        if (prim.IsA<pxr::UsdGeomMesh>())
+        vtkNew<vtkPoints> points;
+        points->Allocate(positions.size());
+        for (const pxr::GfVec3f& p : positions)
         {
-          pxr::UsdGeomMesh meshPrim = pxr::UsdGeomMesh(prim);
+          points->InsertNextPoint(p[0], p[1], p[2]);
+        }
 
-          vtkSmartPointer<vtkPolyData>& mappedPolydata =
-            this->MeshMap[meshPrim.GetPath().GetAsString()];
-          bool meshAlreadyExists = (mappedPolydata != nullptr);
+        newPolyData->SetPoints(points);
 
-          // attributes
-          pxr::UsdAttribute normalsAttr = meshPrim.GetNormalsAttr();
-          pxr::UsdAttribute pointsAttr = meshPrim.GetPointsAttr();
-          pxr::UsdAttribute facesCountAttr = meshPrim.GetFaceVertexCountsAttr();
-          pxr::UsdAttribute facesIndicesAttr = meshPrim.GetFaceVertexIndicesAttr();
+        // faces
+        pxr::VtArray<int> counts;
+        facesCountAttr.Get(&counts, timeCode);
 
-          std::vector<pxr::UsdGeomPrimvar> primVars =
-            pxr::UsdGeomPrimvarsAPI(meshPrim).GetPrimvars();
+        pxr::VtArray<int> indices;
+        facesIndicesAttr.Get(&indices, timeCode);
 
-          auto TimeVarying = [](const auto& a) { return a.ValueMightBeTimeVarying(); };
+        // add polygons
+        vtkNew<vtkCellArray> cells;
+        auto currentCellIt = indices.cbegin();
+        std::vector<vtkIdType> indexArr;
+        for (int c : counts)
+        {
+          indexArr.clear();
+          indexArr.insert(indexArr.begin(), currentCellIt, std::next(currentCellIt, c));
+          cells->InsertNextCell(c, indexArr.data());
+          std::advance(currentCellIt, c);
+        }
 
-          bool animatedAttribute = std::any_of(primVars.cbegin(), primVars.cend(), TimeVarying);
-          animatedAttribute = animatedAttribute || TimeVarying(pointsAttr);
-          animatedAttribute = animatedAttribute || TimeVarying(normalsAttr);
-          animatedAttribute = animatedAttribute || TimeVarying(facesCountAttr);
-          animatedAttribute = animatedAttribute || TimeVarying(facesIndicesAttr);
+        newPolyData->SetPolys(cells);
 
-          // Check if the mesh has to be rebuilt
-          if (!meshAlreadyExists || animatedAttribute)
-          {
-            vtkNew<vtkPolyData> newPolyData;
+        vtkNew<vtkF3DFaceVaryingPointDispatcher> faceVaryingFilter;
+        faceVaryingFilter->SetInputData(newPolyData);
+        faceVaryingFilter->Update();
 
-            // normals
-            pxr::VtArray<pxr::GfVec3f> normals;
-            normalsAttr.Get(&normals, timeCode);
+        mappedPolydata = faceVaryingFilter->GetOutput();
+      }
 
-            if (normals.size() > 0)
-            {
-              vtkNew<vtkFloatArray> vNormals;
-              vNormals->SetName("Normals");
-              vNormals->SetNumberOfComponents(3);
-              vNormals->Allocate(normals.size());
+      polydata = mappedPolydata;
+    }
+    else if (prim.IsA<pxr::UsdGeomSphere>())
+    {
+      pxr::UsdGeomSphere spherePrim = pxr::UsdGeomSphere(prim);
 
-              for (const pxr::GfVec3f& n : normals)
-              {
-                vNormals->InsertNextTuple3(n[0], n[1], n[2]);
-              }
+      vtkNew<vtkSphereSource> sphere;
+      sphere->SetThetaResolution(20);
+      sphere->SetPhiResolution(20);
 
-              vtkInformation* info = vNormals->GetInformation();
-              info->Set(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE(),
-                meshPrim.GetNormalsInterpolation() == pxr::UsdGeomTokens->faceVarying ? 1 : 0);
+      double radius;
+      if (spherePrim.GetRadiusAttr().Get(&radius))
+      {
+        sphere->SetRadius(radius);
+      }
 
-              newPolyData->GetPointData()->SetNormals(vNormals);
-            }
+      sphere->Update();
+      polydata = sphere->GetOutput();
+    }
+    else if (prim.IsA<pxr::UsdGeomCube>())
+    {
+      pxr::UsdGeomCube cubePrim = pxr::UsdGeomCube(prim);
 
-            // texture coordinates
-            bool firstArray = true;
-            for (const pxr::UsdGeomPrimvar& primVar : primVars)
-            {
-              if (primVar.GetTypeName() == "texCoord2f[]" || primVar.GetTypeName() == "float2[]")
-              {
-                pxr::VtArray<pxr::GfVec2f> uvs;
-                primVar.Get(&uvs, timeCode);
+      vtkNew<vtkCubeSource> cube;
 
-                if (uvs.size() > 0)
-                {
-                  std::string name = primVar.GetPrimvarName();
+      double length;
+      if (cubePrim.GetSizeAttr().Get(&length))
+      {
+        cube->SetXLength(length);
+        cube->SetYLength(length);
+        cube->SetZLength(length);
+      }
 
-                  vtkNew<vtkFloatArray> texCoords;
-                  texCoords->SetName(name.c_str());
-                  texCoords->SetNumberOfComponents(2);
+      cube->Update();
+      polydata = cube->GetOutput();
+    }
+    else if (prim.IsA<pxr::UsdGeomCapsule>())
+    {
+      pxr::UsdGeomCapsule capsulePrim = pxr::UsdGeomCapsule(prim);
 
-                  if (primVar.IsIndexed())
-                  {
-                    pxr::UsdAttribute indicesAttr = primVar.GetIndicesAttr();
-
-                    pxr::VtArray<int> indices;
-                    if (indicesAttr.Get(&indices) && indices.size() > 0)
-                    {
-                      texCoords->Allocate(indices.size());
-
-                      for (int index : indices)
-                      {
-                        const pxr::GfVec2f& uv = uvs[index];
-                        texCoords->InsertNextTuple2(uv[0], uv[1]);
-                      }
-                    }
-                  }
-                  else
-                  {
-                    texCoords->Allocate(uvs.size());
+      // See https://gitlab.kitware.com/vtk/vtk/-/merge_requests/10531
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 3, 0)
+      vtkNew<vtkCylinderSource> capsule;
+      capsule->CapsuleCapOn();
 
-                    for (const pxr::GfVec2f& uv : uvs)
-                    {
-                      texCoords->InsertNextTuple2(uv[0], uv[1]);
-                    }
-                  }
+      double height;
+      if (capsulePrim.GetHeightAttr().Get(&height))
+      {
+        capsule->SetHeight(height);
+      }
+#else
+      vtkNew<vtkCapsuleSource> capsule;
 
-                  vtkInformation* info = texCoords->GetInformation();
-                  info->Set(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE(),
-                    primVar.GetInterpolation() == pxr::UsdGeomTokens->faceVarying ? 1 : 0);
+      double height;
+      if (capsulePrim.GetHeightAttr().Get(&height))
+      {
+        capsule->SetCylinderLength(height);
+      }
+#endif
 
-                  // the size of the array can be larger than the number of points if the attribute
-                  // interpolation is face-varying.
-                  // It will be normalized by the vtkF3DFaceVaryingPointDispatcher later
-                  newPolyData->GetPointData()->AddArray(texCoords);
+      double radius;
+      if (capsulePrim.GetRadiusAttr().Get(&radius))
+      {
+        capsule->SetRadius(radius);
+      }
 
-                  if (firstArray)
-                  {
-                    // sometimes we are enable to fetch the array name to use for texture mapping
-                    // so we fallback to the first UV set added
-                    // see https://github.com/f3d-app/f3d/issues/1184
-                    firstArray = false;
-                    newPolyData->GetPointData()->SetTCoords(texCoords);
-                  }
-                }
-              }
-            }
+      // In VTK, the capsule is aligned with the Y axis
+      // In USD, the default is aligned with Z, but can be modified
+      // Let's rotate it if needed
+      vtkNew<vtkTransformFilter> transform;
+      vtkNew<vtkTransform> t;
+      transform->SetTransform(t);
 
-            // points
-            pxr::VtArray<pxr::GfVec3f> positions;
-            pointsAttr.Get(&positions, timeCode);
+      pxr::TfToken axisToken(pxr::UsdGeomTokens->z);
+      capsulePrim.GetAxisAttr().Get(&axisToken);
 
-            vtkNew<vtkPoints> points;
-            points->Allocate(positions.size());
-            for (const pxr::GfVec3f& p : positions)
-            {
-              points->InsertNextPoint(p[0], p[1], p[2]);
-            }
+      if (axisToken == pxr::UsdGeomTokens->x)
+      {
+        t->RotateZ(90.0);
+      }
+      else if (axisToken == pxr::UsdGeomTokens->z)
+      {
+        t->RotateX(90.0);
+      }
 
-            newPolyData->SetPoints(points);
+      transform->SetInputConnection(capsule->GetOutputPort());
+      transform->Update();
+      polydata = vtkPolyData::SafeDownCast(transform->GetOutput());
+    }
+    else if (prim.IsA<pxr::UsdGeomCylinder>())
+    {
+      pxr::UsdGeomCylinder cylinderPrim = pxr::UsdGeomCylinder(prim);
+      vtkNew<vtkCylinderSource> cylinder;
+      cylinder->SetResolution(20);
 
-            // faces
-            pxr::VtArray<int> counts;
-            facesCountAttr.Get(&counts, timeCode);
+      double height;
+      if (cylinderPrim.GetHeightAttr().Get(&height))
+      {
+        cylinder->SetHeight(height);
+      }
 
-            pxr::VtArray<int> indices;
-            facesIndicesAttr.Get(&indices, timeCode);
+      double radius;
+      if (cylinderPrim.GetRadiusAttr().Get(&radius))
+      {
+        cylinder->SetRadius(radius);
+      }
 
-            // add polygons
-            vtkNew<vtkCellArray> cells;
-            auto currentCellIt = indices.cbegin();
-            std::vector<vtkIdType> indexArr;
-            for (int c : counts)
-            {
-              indexArr.clear();
-              indexArr.insert(indexArr.begin(), currentCellIt, std::next(currentCellIt, c));
-              cells->InsertNextCell(c, indexArr.data());
-              std::advance(currentCellIt, c);
-            }
+      // In VTK, the cylinder is aligned with the Y axis
+      // In USD, the default is aligned with Z, but can be modified
+      // Let's rotate it if needed
+      vtkNew<vtkTransformFilter> transform;
+      vtkNew<vtkTransform> t;
+      transform->SetTransform(t);
 
-            newPolyData->SetPolys(cells);
+      pxr::TfToken axisToken(pxr::UsdGeomTokens->z);
+      cylinderPrim.GetAxisAttr().Get(&axisToken);
 
-            vtkNew<vtkF3DFaceVaryingPointDispatcher> faceVaryingFilter;
-            faceVaryingFilter->SetInputData(newPolyData);
-            faceVaryingFilter->Update();
+      if (axisToken == pxr::TfToken(pxr::UsdGeomTokens->x))
+      {
+        t->RotateZ(90.0);
+      }
+      else if (axisToken == pxr::TfToken(pxr::UsdGeomTokens->z))
+      {
+        t->RotateX(90.0);
+      }
 
-            mappedPolydata = faceVaryingFilter->GetOutput();
-          }
+      transform->SetInputConnection(cylinder->GetOutputPort());
+      transform->Update();
+      polydata = vtkPolyData::SafeDownCast(transform->GetOutput());
+    }
+    else if (prim.IsA<pxr::UsdGeomCone>())
+    {
+      pxr::UsdGeomCone conePrim = pxr::UsdGeomCone(prim);
+      vtkNew<vtkConeSource> cone;
+      cone->SetResolution(20);
 
-          polydata = mappedPolydata;
-        }
-        else if (prim.IsA<pxr::UsdGeomSphere>())
-        {
-          pxr::UsdGeomSphere spherePrim = pxr::UsdGeomSphere(prim);
+      double height;
+      if (conePrim.GetHeightAttr().Get(&height))
+      {
+        cone->SetHeight(height);
+      }
 
-          vtkNew<vtkSphereSource> sphere;
-          sphere->SetThetaResolution(20);
-          sphere->SetPhiResolution(20);
+      double radius;
+      if (conePrim.GetRadiusAttr().Get(&radius))
+      {
+        cone->SetRadius(radius);
+      }
 
-          double radius;
-          if (spherePrim.GetRadiusAttr().Get(&radius))
-          {
-            sphere->SetRadius(radius);
-          }
+      // In VTK, the cylinder is aligned with the X axis
+      // In USD, the default is aligned with Z, but can be modified
+      // Let's rotate it if needed
+      vtkNew<vtkTransformFilter> transform;
+      vtkNew<vtkTransform> t;
+      transform->SetTransform(t);
 
-          sphere->Update();
-          polydata = sphere->GetOutput();
-        }
-        else if (prim.IsA<pxr::UsdGeomCube>())
-        {
-          pxr::UsdGeomCube cubePrim = pxr::UsdGeomCube(prim);
+      pxr::TfToken axisToken(pxr::UsdGeomTokens->z);
+      conePrim.GetAxisAttr().Get(&axisToken);
 
-          vtkNew<vtkCubeSource> cube;
+      if (axisToken == pxr::TfToken(pxr::UsdGeomTokens->y))
+      {
+        t->RotateZ(90.0);
+      }
+      else if (axisToken == pxr::TfToken(pxr::UsdGeomTokens->z))
+      {
+        t->RotateY(90.0);
+      }
 
-          double length;
-          if (cubePrim.GetSizeAttr().Get(&length))
-          {
-            cube->SetXLength(length);
-            cube->SetYLength(length);
-            cube->SetZLength(length);
-          }
+      transform->SetInputConnection(cone->GetOutputPort());
+      transform->Update();
+      polydata = vtkPolyData::SafeDownCast(transform->GetOutput());
+    }
 
-          cube->Update();
-          polydata = cube->GetOutput();
-        }
-        else if (prim.IsA<pxr::UsdGeomCapsule>())
-        {
-          pxr::UsdGeomCapsule capsulePrim = pxr::UsdGeomCapsule(prim);
+    return polydata;
+  }
 
-          // See https://gitlab.kitware.com/vtk/vtk/-/merge_requests/10531
-#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 3, 0)
-          vtkNew<vtkCylinderSource> capsule;
-          capsule->CapsuleCapOn();
+  void ImportPointInstancer(vtkRenderer* renderer, const pxr::UsdGeomPointInstancer& instancer,
+    const pxr::SdfPath& path, vtkMatrix4x4* currentMatrix, pxr::UsdTimeCode timeCode)
+  {
+    pxr::SdfPathVector prototypes;
+    instancer.GetPrototypesRel().GetForwardedTargets(&prototypes);
+
+    pxr::VtIntArray protoIndices;
+    instancer.GetProtoIndicesAttr().Get(&protoIndices, timeCode);
+
+    // prototype root transforms are applied to the glyph sources instead, see ImportPrim
+    pxr::VtMatrix4dArray xforms;
+    if (prototypes.empty() ||
+      !instancer.ComputeInstanceTransformsAtTime(&xforms, timeCode, timeCode,
+        pxr::UsdGeomPointInstancer::ExcludeProtoXform, pxr::UsdGeomPointInstancer::IgnoreMask) ||
+      xforms.size() != protoIndices.size())
+    {
+      return;
+    }
 
-          double height;
-          if (capsulePrim.GetHeightAttr().Get(&height))
-          {
-            capsule->SetHeight(height);
-          }
-#else
-          vtkNew<vtkCapsuleSource> capsule;
+    std::vector<bool> mask = instancer.ComputeMaskAtTime(timeCode);
 
-          double height;
-          if (capsulePrim.GetHeightAttr().Get(&height))
-          {
-            capsule->SetCylinderLength(height);
-          }
-#endif
+    // split instances per prototype and decompose their transform for the glyph mapper
+    std::vector<InstancingInfo> instancings(prototypes.size());
+    for (InstancingInfo& instancing : instancings)
+    {
+      vtkNew<vtkFloatArray> orientations;
+      orientations->SetName("Orientation");
+      orientations->SetNumberOfComponents(4);
 
-          double radius;
-          if (capsulePrim.GetRadiusAttr().Get(&radius))
-          {
-            capsule->SetRadius(radius);
-          }
+      vtkNew<vtkFloatArray> scales;
+      scales->SetName("Scale");
+      scales->SetNumberOfComponents(3);
 
-          // In VTK, the capsule is aligned with the Y axis
-          // In USD, the default is aligned with Z, but can be modified
-          // Let's rotate it if needed
-          vtkNew<vtkTransformFilter> transform;
-          vtkNew<vtkTransform> t;
-          transform->SetTransform(t);
+      vtkNew<vtkPoints> positions;
 
-          pxr::TfToken axisToken(pxr::UsdGeomTokens->z);
-          capsulePrim.GetAxisAttr().Get(&axisToken);
+      instancing.Instances = vtkSmartPointer<vtkPolyData>::New();
+      instancing.Instances->SetPoints(positions);
+      instancing.Instances->GetPointData()->AddArray(orientations);
+      instancing.Instances->GetPointData()->AddArray(scales);
+    }
 
-          if (axisToken == pxr::UsdGeomTokens->x)
-          {
-            t->RotateZ(90.0);
-          }
-          else if (axisToken == pxr::UsdGeomTokens->z)
-          {
-            t->RotateX(90.0);
-          }
+    for (size_t i = 0; i < xforms.size(); i++)
+    {
+      const int protoIndex = protoIndices[i];
+      if ((!mask.empty() && !mask[i]) || protoIndex < 0 ||
+        protoIndex >= static_cast<int>(prototypes.size()))
+      {
+        continue;
+      }
 
-          transform->SetInputConnection(capsule->GetOutputPort());
-          transform->Update();
-          polydata = vtkPolyData::SafeDownCast(transform->GetOutput());
-        }
-        else if (prim.IsA<pxr::UsdGeomCylinder>())
-        {
-          pxr::UsdGeomCylinder cylinderPrim = pxr::UsdGeomCylinder(prim);
-          vtkNew<vtkCylinderSource> cylinder;
-          cylinder->SetResolution(20);
+      pxr::GfTransform transform(xforms[i]);
+      const pxr::GfVec3d& t = transform.GetTranslation();
+      const pxr::GfQuatd q = transform.GetRotation().GetQuat();
+      const pxr::GfVec3d& s = transform.GetScale();
+
+      vtkPolyData* instances = instancings[protoIndex].Instances;
+      vtkPointData* pointData = instances->GetPointData();
+      instances->GetPoints()->InsertNextPoint(t[0], t[1], t[2]);
+      pointData->GetArray("Orientation")
+        ->InsertNextTuple4(q.GetReal(), q.GetImaginary()[0], q.GetImaginary()[1],
+          q.GetImaginary()[2]);
+      pointData->GetArray("Scale")->InsertNextTuple3(s[0], s[1], s[2]);
+    }
 
-          double height;
-          if (cylinderPrim.GetHeightAttr().Get(&height))
-          {
-            cylinder->SetHeight(height);
-          }
+    auto instancerMatrix = this->GetLocalTransform(instancer, timeCode);
+    vtkMatrix4x4::Multiply4x4(currentMatrix, instancerMatrix, instancerMatrix);
 
-          double radius;
-          if (cylinderPrim.GetRadiusAttr().Get(&radius))
-          {
-            cylinder->SetRadius(radius);
-          }
+    pxr::UsdGeomXformCache xformCache(timeCode);
+    for (size_t p = 0; p < prototypes.size(); p++)
+    {
+      InstancingInfo& instancing = instancings[p];
+      pxr::UsdPrim prototype = this->Stage->GetPrimAtPath(prototypes[p]);
+      if (!prototype || instancing.Instances->GetNumberOfPoints() == 0)
+      {
+        continue;
+      }
 
-          // In VTK, the cylinder is aligned with the Y axis
-          // In USD, the default is aligned with Z, but can be modified
-          // Let's rotate it if needed
-          vtkNew<vtkTransformFilter> transform;
-          vtkNew<vtkTransform> t;
-          transform->SetTransform(t);
+      instancing.InstancerMatrix = instancerMatrix;
+      instancing.PrototypeParentInverse =
+        this->ConvertMatrix(xformCache.GetParentToWorldTransform(prototype));
+      vtkMatrix4x4::Multiply4x4(
+        currentMatrix, instancing.PrototypeParentInverse, instancing.PrototypeParentInverse);
+      instancing.PrototypeParentInverse->Invert();
 
-          pxr::TfToken axisToken(pxr::UsdGeomTokens->z);
-          cylinderPrim.GetAxisAttr().Get(&axisToken);
+      this->ImportPrim(renderer, prototype, path, currentMatrix, &instancing);
+    }
+  }
 
-          if (axisToken == pxr::TfToken(pxr::UsdGeomTokens->x))
-          {
-            t->RotateZ(90.0);
-          }
-          else if (axisToken == pxr::TfToken(pxr::UsdGeomTokens->z))
-          {
-            t->RotateX(90.0);
-          }
+  void ImportNode(vtkRenderer* renderer, const pxr::UsdPrim& node, const pxr::SdfPath& path,
+    vtkMatrix4x4* currentMatrix, const InstancingInfo* instancing = nullptr)
+  {
+    // simple range-for iteration
+    for (pxr::UsdPrim prim : pxr::UsdPrimSiblingRange(node.GetAllChildren()))
+    {
+      this->ImportPrim(renderer, prim, path, currentMatrix, instancing);
+    }
+  }
 
-          transform->SetInputConnection(cylinder->GetOutputPort());
-          transform->Update();
-          polydata = vtkPolyData::SafeDownCast(transform->GetOutput());
-        }
-        else if (prim.IsA<pxr::UsdGeomCone>())
-        {
-          pxr::UsdGeomCone conePrim = pxr::UsdGeomCone(prim);
-          vtkNew<vtkConeSource> cone;
-          cone->SetResolution(20);
+  void ImportPrim(vtkRenderer* renderer, const pxr::UsdPrim& prim, const pxr::SdfPath& path,
+    vtkMatrix4x4* currentMatrix, const InstancingInfo* instancing)
+  {
+    pxr::UsdTimeCode timeCode = this->CurrentTime * this->Stage->GetTimeCodesPerSecond();
 
-          double height;
-          if (conePrim.GetHeightAttr().Get(&height))
-          {
-            cone->SetHeight(height);
-          }
+    if (prim.IsA<pxr::UsdGeomImageable>())
+    {
+      pxr::UsdGeomImageable imageable = pxr::UsdGeomImageable(prim);
+
+      pxr::TfToken visibility;
+      pxr::UsdAttribute visAttr = imageable.GetVisibilityAttr();
+      this->NeedsFullUpdate =
+        this->NeedsFullUpdate || (visAttr && visAttr.ValueMightBeTimeVarying());
+      if (visAttr && visAttr.HasAuthoredValue() && visAttr.Get(&visibility, timeCode) &&
+        visibility == pxr::UsdGeomTokens->invisible)
+      {
+        // not visible, skip
+        return;
+      }
 
-          double radius;
-          if (conePrim.GetRadiusAttr().Get(&radius))
-          {
-            cone->SetRadius(radius);
-          }
+      pxr::TfToken purpose;
+      pxr::UsdAttribute purpAttr = imageable.GetPurposeAttr();
+      if (purpAttr && purpAttr.HasAuthoredValue() && purpAttr.Get(&purpose, timeCode) &&
+        (purpose == pxr::UsdGeomTokens->proxy || purpose == pxr::UsdGeomTokens->guide))
+      {
+        // proxy, skip
+        return;
+      }
+    }
 
-          // In VTK, the cylinder is aligned with the X axis
-          // In USD, the default is aligned with Z, but can be modified
-          // Let's rotate it if needed
-          vtkNew<vtkTransformFilter> transform;
-          vtkNew<vtkTransform> t;
-          transform->SetTransform(t);
+    if (prim.IsInstance())
+    {
+      pxr::UsdGeomXform xform = pxr::UsdGeomXform(prim);
 
-          pxr::TfToken axisToken(pxr::UsdGeomTokens->z);
-          conePrim.GetAxisAttr().Get(&axisToken);
+      // the instance transform is baked in the prototype actors matrices
+      this->NeedsFullUpdate = this->NeedsFullUpdate || this->IsTransformTimeVarying(prim);
 
-          if (axisToken == pxr::TfToken(pxr::UsdGeomTokens->y))
-          {
-            t->RotateZ(90.0);
-          }
-          else if (axisToken == pxr::TfToken(pxr::UsdGeomTokens->z))
-          {
-            t->RotateY(90.0);
-          }
+      auto mat = this->GetLocalTransform(xform, timeCode);
+      vtkMatrix4x4::Multiply4x4(currentMatrix, mat, mat);
 
-          transform->SetInputConnection(cone->GetOutputPort());
-          transform->Update();
-          polydata = vtkPolyData::SafeDownCast(transform->GetOutput());
-        }
+      this->ImportNode(
+        renderer, prim.GetPrototype(), path.AppendChild(prim.GetName()), mat, instancing);
+    }
+    else if (prim.IsA<pxr::UsdGeomPointInstancer>())
+    {
+      if (instancing)
+      {
+        vtkWarningWithObjectMacro(nullptr,
+          "Nested point instancers are not supported, skipping " << prim.GetPath().GetAsString());
+        return;
+      }
+
+      // instances are recomputed from scratch when anything moves
+      this->NeedsFullUpdate = this->NeedsFullUpdate || this->IsTimeVarying(prim) ||
+        this->IsTransformTimeVarying(prim);
+
+      this->ImportPointInstancer(renderer, pxr::UsdGeomPointInstancer(prim),
+        path.AppendChild(prim.GetName()), currentMatrix, timeCode);
+    }
+    else if (prim.IsA<pxr::UsdGeomGprim>())
+    {
+      pxr::UsdGeomGprim geomPrim = pxr::UsdGeomGprim(prim);
+
+      vtkSmartPointer<vtkPolyData> polydata = this->CreatePolyData(prim, timeCode);
+
+      // create actors
 
-        // create actors
+      // get xform
+      auto mat = this->GetLocalTransform(geomPrim, timeCode);
+      vtkMatrix4x4::Multiply4x4(currentMatrix, mat, mat);
+
+      vtkPolyData* instances = nullptr;
+      if (instancing && polydata)
+      {
+        // instances transforms are relative to the prototype parent, move the geometry
+        // there and render it at the instancer location
+        vtkNew<vtkTransform> relative;
+        relative->Concatenate(instancing->PrototypeParentInverse);
+        relative->Concatenate(mat);
+
+        vtkNew<vtkTransformFilter> transform;
+        transform->SetTransform(relative);
+        transform->SetInputData(polydata);
+        transform->Update();
+        polydata = vtkPolyData::SafeDownCast(transform->GetOutput());
+
+        mat->DeepCopy(instancing->InstancerMatrix);
+        instances = instancing->Instances;
+      }
 
-        // get xform
-        auto mat = this->GetLocalTransform(geomPrim, timeCode);
-        vtkMatrix4x4::Multiply4x4(currentMatrix, mat, mat);
+      std::vector<pxr::UsdGeomSubset> subsets = pxr::UsdGeomSubset::GetGeomSubsets(geomPrim);
 
-        std::vector<pxr::UsdGeomSubset> subsets = pxr::UsdGeomSubset::GetGeomSubsets(geomPrim);
+      // record what needs to be re-evaluated when the time changes, see UpdateAnimatedActors
+      AnimatedActor animated;
+      animated.Prim = prim;
+      animated.TransformVarying = this->IsTransformTimeVarying(prim);
+      animated.GeometryVarying = this->IsTimeVarying(prim);
+      animated.ParentMatrix = vtkSmartPointer<vtkMatrix4x4>::New();
+      animated.ParentMatrix->DeepCopy(currentMatrix);
 
-        if (subsets.empty())
+      const bool varying = animated.TransformVarying || animated.GeometryVarying;
+      if (varying && (instancing || (!subsets.empty() && animated.GeometryVarying)))
+      {
+        this->NeedsFullUpdate = true;
+      }
+
+      if (subsets.empty())
+      {
+        animated.Actor = this->AddActor(renderer, path, geomPrim, prim, mat, polydata, instances);
+        if (varying)
         {
-          this->AddActor(renderer, path, geomPrim, prim, mat, polydata);
+          this->AnimatedActors.emplace_back(animated);
         }
-        else
+      }
+      else
+      {
+        // split subsets
+        for (const pxr::UsdGeomSubset& subset : subsets)
         {
-          // split subsets
-          for (const pxr::UsdGeomSubset& subset : subsets)
-          {
-            pxr::UsdAttribute indicesAttr = subset.GetIndicesAttr();
+          pxr::UsdAttribute indicesAttr = subset.GetIndicesAttr();
 
-            pxr::VtArray<int> indices;
-            indicesAttr.Get(&indices, timeCode);
+          pxr::VtArray<int> indices;
+          indicesAttr.Get(&indices, timeCode);
 
-            vtkNew<vtkPolyData> polydataSubset;
-            polydataSubset->SetPoints(polydata->GetPoints());
-            polydataSubset->GetPointData()->ShallowCopy(polydata->GetPointData());
+          vtkNew<vtkPolyData> polydataSubset;
+          polydataSubset->SetPoints(polydata->GetPoints());
+          polydataSubset->GetPointData()->ShallowCopy(polydata->GetPointData());
 
-            vtkCellArray* mainPolys = polydata->GetPolys();
+          vtkCellArray* mainPolys = polydata->GetPolys();
 
-            // add polygons
-            vtkNew<vtkCellArray> cells;
-            for (int cellId : indices)
-            {
-              vtkIdType cellSize;
-              const vtkIdType* cellPoints;
-              mainPolys->GetCellAtId(cellId, cellSize, cellPoints);
-              cells->InsertNextCell(cellSize, cellPoints);
-            }
+          // add polygons
+          vtkNew<vtkCellArray> cells;
+          for (int cellId : indices)
+          {
+            vtkIdType cellSize;
+            const vtkIdType* cellPoints;
+            mainPolys->GetCellAtId(cellId, cellSize, cellPoints);
+            cells->InsertNextCell(cellSize, cellPoints);
+          }
 
-            polydataSubset->SetPolys(cells);
+          polydataSubset->SetPolys(cells);
 
+          animated.Actor =
             this->AddActor(renderer, path.AppendChild(pxr::TfToken(prim.GetName())), geomPrim,
-              subset.GetPrim(), mat, polydataSubset);
+              subset.GetPrim(), mat, polydataSubset, instances);
+          if (varying)
+          {
+            this->AnimatedActors.emplace_back(animated);
           }
         }
       }
-      else
-      {
-        // just traverse the node
-        this->ImportNode(renderer, prim, path.AppendChild(prim.GetName()), currentMatrix);
-      }
+    }
+    else
+    {
+      // just traverse the node
+      this->ImportNode(renderer, prim, path.AppendChild(prim.GetName()), currentMatrix, instancing);
     }
   }
 
@@ -729,6 +923,9 @@ public:
       return false;
     }
 
+    this->AnimatedActors.clear();
+    this->NeedsFullUpdate = false;
+
     vtkNew<vtkMatrix4x4> rootTransform;
 
     pxr::TfToken up = pxr::UsdGeomGetStageUpAxis(this->Stage);
@@ -745,9 +942,77 @@ public:
     }
 
     this->ImportNode(renderer, this->Stage->GetPseudoRoot(), pxr::SdfPath("/"), rootTransform);
+    this->Imported = true;
     return true;
   }
 
+  /**
+   * Re-evaluate only the actors recorded as time-varying during the last import
+   * Return false if the stage has animated content requiring a full import instead
+   */
+  bool UpdateAnimatedActors()
+  {
+    if (!this->Imported || this->NeedsFullUpdate)
+    {
+      return false;
+    }
+
+    pxr::UsdTimeCode timeCode = this->CurrentTime * this->Stage->GetTimeCodesPerSecond();
+    pxr::UsdGeomXformCache xformCache(timeCode);
+
+    for (const AnimatedActor& animated : this->AnimatedActors)
+    {
+      if (animated.TransformVarying)
+      {
+        auto mat = this->ConvertMatrix(xformCache.GetLocalToWorldTransform(animated.Prim));
+        vtkMatrix4x4::Multiply4x4(animated.ParentMatrix, mat, animated.Actor->GetUserMatrix());
+      }
+
+      if (animated.GeometryVarying)
+      {
+        vtkSmartPointer<vtkPolyData> polydata = this->CreatePolyData(animated.Prim, timeCode);
+        if (polydata)
+        {
+          this->UpdateMapper(animated.Actor, polydata, nullptr);
+        }
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Check if the transform of a prim or of any of its ancestors may change over time
+   */
+  bool IsTransformTimeVarying(const pxr::UsdPrim& prim)
+  {
+    for (pxr::UsdPrim current = prim; current && !current.IsPseudoRoot();
+         current = current.GetParent())
+    {
+      pxr::UsdGeomXformable xformable(current);
+      if (xformable && xformable.TransformMightBeTimeVarying())
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * Check if any attribute of a prim, transform operations excepted, may change over time
+   */
+  bool IsTimeVarying(const pxr::UsdPrim& prim)
+  {
+    for (const pxr::UsdAttribute& attr : prim.GetAttributes())
+    {
+      if (!pxr::UsdGeomXformOp::IsXformOp(attr) &&
+        attr.GetName() != pxr::UsdGeomTokens->xformOpOrder && attr.ValueMightBeTimeVarying())
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
   vtkSmartPointer<vtkImageData> CombineORMImage(
     vtkImageData* occlusionImage, vtkImageData* roughnessImage, vtkImageData* metallicImage)
   {
@@ -832,6 +1097,84 @@ public:
     return appendChannels->GetOutput();
   }
 
+  /**
+   * Submit the decode of the image file of a UsdUVTexture sampler, if not already decoded,
+   * so that the images of a material are decoded in parallel, see GetVTKTexture
+   */
+  void SubmitTexture(const pxr::UsdShadeShader& samplerPrim)
+  {
+    if (!samplerPrim)
+    {
+      return;
+    }
+
+    pxr::TfToken idToken;
+    bool defined = samplerPrim.GetIdAttr().Get(&idToken);
+    const std::string samplerPath = samplerPrim.GetPath().GetAsString();
+    if (!defined || idToken != pxr::TfToken("UsdUVTexture") ||
+      this->TextureMap[samplerPath] != nullptr || this->PendingImages.count(samplerPath) > 0)
+    {
+      return;
+    }
+
+    pxr::SdfAssetPath path;
+    pxr::UsdShadeInput fileInput = samplerPrim.GetInput(pxr::TfToken("file"));
+    if (!fileInput || !fileInput.Get(&path))
+    {
+      return;
+    }
+
+    vtkSmartPointer<vtkImageReader2> reader;
+
+    const std::string& assetPath = path.GetAssetPath();
+    std::string ext = assetPath.substr(assetPath.find_last_of('.'));
+    reader.TakeReference(vtkImageReader2Factory::CreateImageReader2FromExtension(ext.c_str()));
+    if (!reader)
+    {
+      // cannot read the image file
+      vtkErrorWithObjectMacro(nullptr, "Cannot create reader for image: " << assetPath);
+      return;
+    }
+
+    const std::string& resolvedPath = path.GetResolvedPath();
+    auto asset = pxr::ArGetResolver().OpenAsset(pxr::ArResolvedPath(resolvedPath));
+
+    if (!asset)
+    {
+      // cannot get USD asset
+      vtkErrorWithObjectMacro(nullptr, "Cannot recover USD asset");
+      return;
+    }
+
+    auto buffer = asset->GetBuffer();
+
+    if (!buffer)
+    {
+      // buffer invalid
+      vtkErrorWithObjectMacro(nullptr, "Cannot recover buffer");
+      return;
+    }
+
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
+    vtkNew<vtkMemoryResourceStream> stream;
+    stream->SetBuffer(buffer.get(), asset->GetSize());
+    reader->SetStream(stream);
+#else
+    reader->SetMemoryBuffer(buffer.get());
+    reader->SetMemoryBufferLength(asset->GetSize());
+#endif
+
+    // share the decoded image with other importers reading the same asset
+    std::string filePath = resolvedPath.substr(0, resolvedPath.find('['));
+    std::string key =
+      F3DTextureDecoder::GetCacheKey(filePath) + resolvedPath.substr(filePath.size());
+
+    PendingImage& pending = this->PendingImages[samplerPath];
+    pending.Image = F3DTextureDecoder::DecodeReader(reader, key);
+    pending.Buffer = buffer;
+    pending.AssetPath = assetPath;
+  }
+
   // returns the image and the texture coordinate name
   vtkSmartPointer<vtkImageData> GetVTKTexture(
     const pxr::UsdShadeShader& samplerPrim, const pxr::TfToken& token)
@@ -874,61 +1217,31 @@ public:
       }
     }
 
-    auto& tex = this->TextureMap[samplerPrim.GetPath().GetAsString()];
+    const std::string samplerPath = samplerPrim.GetPath().GetAsString();
+    auto& tex = this->TextureMap[samplerPath];
 
     if (tex == nullptr)
     {
-      pxr::SdfAssetPath path;
-      pxr::UsdShadeInput fileInput = samplerPrim.GetInput(pxr::TfToken("file"));
-      if (fileInput && fileInput.Get(&path))
+      // wait for the decoded image only now that it is needed
+      this->SubmitTexture(samplerPrim);
+      auto pendingIt = this->PendingImages.find(samplerPath);
+      if (pendingIt == this->PendingImages.end())
       {
-        vtkSmartPointer<vtkImageReader2> reader;
-
-        const std::string& assetPath = path.GetAssetPath();
-        std::string ext = assetPath.substr(assetPath.find_last_of('.'));
-        reader.TakeReference(vtkImageReader2Factory::CreateImageReader2FromExtension(ext.c_str()));
-        if (!reader)
-        {
-          // cannot read the image file
-          vtkErrorWithObjectMacro(nullptr, "Cannot create reader for image: " << assetPath);
-          return nullptr;
-        }
-
-        const std::string& resolvedPath = path.GetResolvedPath();
-        auto asset = pxr::ArGetResolver().OpenAsset(pxr::ArResolvedPath(resolvedPath));
-
-        if (!asset)
-        {
-          // cannot get USD asset
-          vtkErrorWithObjectMacro(nullptr, "Cannot recover USD asset");
-          return nullptr;
-        }
-
-        auto buffer = asset->GetBuffer();
-
-        if (!buffer)
-        {
-          // buffer invalid
-          vtkErrorWithObjectMacro(nullptr, "Cannot recover buffer");
-          return nullptr;
-        }
-
-#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
-        vtkNew<vtkMemoryResourceStream> stream;
-        stream->SetBuffer(buffer.get(), asset->GetSize());
-        reader->SetStream(stream);
-#else
-        reader->SetMemoryBuffer(buffer.get());
-        reader->SetMemoryBufferLength(asset->GetSize());
-#endif
-        reader->Update();
-
-        tex = reader->GetOutput();
+        return nullptr;
       }
-      else
+
+      vtkSmartPointer<vtkImageData> image = pendingIt->second.Image.get();
+      const std::string assetPath = pendingIt->second.AssetPath;
+      this->PendingImages.erase(pendingIt);
+      if (!image)
       {
+        vtkErrorWithObjectMacro(nullptr, "Cannot read image: " << assetPath);
         return nullptr;
       }
+
+      // a shallow copy is used as its information is modified below
+      tex = vtkSmartPointer<vtkImageData>::New();
+      tex->ShallowCopy(image);
     }
 
     tex->GetInformation()->Set(vtkF3DUSDImporter::TCOORDS_NAME(), name);
@@ -995,6 +1308,14 @@ public:
         prop = vtkSmartPointer<vtkProperty>::New();
         prop->SetInterpolationToPBR();
 
+        // decode all the images of the material in parallel
+        for (const char* input : { "diffuseColor", "opacity", "emissiveColor", "roughness",
+               "metallic", "occlusion", "normal" })
+        {
+          this->SubmitTexture(
+            this->GetConnectedShaderPrim(shaderPrim.GetInput(pxr::TfToken(input))).first);
+        }
+
         vtkInformation* info = prop->GetInformation();
 
         // diffuseColor
@@ -1193,8 +1514,32 @@ private:
   std::unordered_map<std::string, vtkSmartPointer<vtkPolyData>> MeshMap;
   std::unordered_map<std::string, vtkSmartPointer<vtkProperty>> ShaderMap;
   std::unordered_map<std::string, vtkSmartPointer<vtkImageData>> TextureMap;
+
+  // Images being decoded, keyed by sampler path, with the buffer they are decoded from
+  struct PendingImage
+  {
+    F3DTextureDecoder::Image Image;
+    std::shared_ptr<const char> Buffer;
+    std::string AssetPath;
+  };
+  std::unordered_map<std::string, PendingImage> PendingImages;
   double CurrentTime = 0.0;
 
+  struct AnimatedActor
+  {
+    vtkSmartPointer<vtkActor> Actor;
+    pxr::UsdPrim Prim;
+
+    // transform of the parent native instance if any, the prim world transform is applied on top
+    vtkSmartPointer<vtkMatrix4x4> ParentMatrix;
+
+    bool TransformVarying = false;
+    bool GeometryVarying = false;
+  };
+  std::vector<AnimatedActor> AnimatedActors;
+  bool NeedsFullUpdate = false;
+  bool Imported = false;
+
   class DiagDelegate : public pxr::TfDiagnosticMgr::Delegate
   {
   public:
@@ -1282,7 +1627,12 @@ bool vtkF3DUSDImporter::GetTemporalInformation(vtkIdType vtkNotUsed(animationInd
 bool vtkF3DUSDImporter::UpdateAtTimeValue(double timeValue)
 {
   this->Internals->SetCurrentTime(timeValue);
-  this->Update();
+
+  // only re-evaluate time-varying prims when possible
+  if (!this->Internals->UpdateAnimatedActors())
+  {
+    this->Update();
+  }
   return this->Superclass::UpdateAtTimeValue(timeValue);
 }
 
@@ -0,0 +1,46 @@
+#include "vtkF3DOpenVDBReader.h"
+
+#include <vtkNew.h>
+
+#include <cmath>
+#include <iostream>
+
+int TestF3DOpenVDBReader(int vtkNotUsed(argc), char* argv[])
+{
+  std::string filename = std::string(argv[1]) + "data/icosahedron.vdb";
+
+  vtkNew<vtkF3DOpenVDBReader> reader;
+  reader->SetFileName(filename.c_str());
+
+  double size = reader->EstimateFullResolutionSize();
+  if (size <= 0)
+  {
+    std::cerr << "Cannot estimate the size of the volume\n";
+    return EXIT_FAILURE;
+  }
+
+  if (!reader->FitDownsamplingFactor(2 * size / (1024 * 1024)) ||
+    reader->GetDownsamplingFactor() != 1.0)
+  {
+    std::cerr << "Volume fitting in the budget should be read at full resolution\n";
+    return EXIT_FAILURE;
+  }
+
+  if (!reader->FitDownsamplingFactor(size / (8 * 1024 * 1024)) ||
+    std::abs(reader->GetDownsamplingFactor() - 0.5) > 1e-3)
+  {
+    std::cerr << "Unexpected downsampling factor: " << reader->GetDownsamplingFactor() << "\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkF3DOpenVDBReader> invalidReader;
+  invalidReader->SetFileName((std::string(argv[1]) + "data/cow.vtp").c_str());
+  if (invalidReader->FitDownsamplingFactor(1.0))
+  {
+    std::cerr << "Metadata should not be read from a non VDB file\n";
+    return EXIT_FAILURE;
+  }
+
+  reader->Update();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,117 @@
+#include "vtkF3DOpenVDBReader.h"
+
+#include <vtkObjectFactory.h>
+
+#include <openvdb/io/File.h>
+#include <openvdb/openvdb.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace
+{
+//----------------------------------------------------------------------------
+/**
+ * Size in bytes of a value of the provided grid value type once converted to an image,
+ * 0 for point data and string grids which are not converted to images
+ */
+double GetValueSize(const std::string& valueType)
+{
+  if (valueType == "bool" || valueType == "mask")
+  {
+    return 1;
+  }
+  else if (valueType == "float" || valueType == "int32" || valueType == "uint32")
+  {
+    return 4;
+  }
+  else if (valueType == "double" || valueType == "int64")
+  {
+    return 8;
+  }
+  else if (valueType == "vec3s" || valueType == "vec3i")
+  {
+    return 12;
+  }
+  else if (valueType == "vec3d")
+  {
+    return 24;
+  }
+  return 0;
+}
+}
+
+vtkStandardNewMacro(vtkF3DOpenVDBReader);
+
+//----------------------------------------------------------------------------
+double vtkF3DOpenVDBReader::EstimateFullResolutionSize()
+{
+  if (!this->GetFileName())
+  {
+    return -1;
+  }
+
+  openvdb::initialize();
+
+  openvdb::GridPtrVecPtr grids;
+  try
+  {
+    openvdb::io::File file(this->GetFileName());
+    file.open();
+    grids = file.readAllGridMetadata();
+    file.close();
+  }
+  catch (const openvdb::Exception& ex)
+  {
+    vtkDebugMacro("Cannot read grid metadata: " << ex.what());
+    return -1;
+  }
+
+  // Merged grids are converted to images covering the union of their bounding boxes,
+  // with one array per grid
+  openvdb::CoordBBox bbox;
+  double valueSize = 0;
+  for (const openvdb::GridBase::Ptr& grid : *grids)
+  {
+    const double size = ::GetValueSize(grid->valueType());
+    if (size == 0)
+    {
+      continue;
+    }
+
+    auto bboxMin = grid->getMetadata<openvdb::Vec3IMetadata>(openvdb::GridBase::META_FILE_BBOX_MIN);
+    auto bboxMax = grid->getMetadata<openvdb::Vec3IMetadata>(openvdb::GridBase::META_FILE_BBOX_MAX);
+    if (!bboxMin || !bboxMax)
+    {
+      // Written without statistics
+      return -1;
+    }
+
+    bbox.expand(
+      openvdb::CoordBBox(openvdb::Coord(bboxMin->value()), openvdb::Coord(bboxMax->value())));
+    valueSize += size;
+  }
+
+  return bbox.empty() ? 0 : static_cast<double>(bbox.volume()) * valueSize;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DOpenVDBReader::FitDownsamplingFactor(double budget)
+{
+  const double size = this->EstimateFullResolutionSize();
+  if (size < 0)
+  {
+    return false;
+  }
+
+  // The factor is applied on each axis
+  const double budgetBytes = budget * 1024 * 1024;
+  double factor = 1.0;
+  if (size > budgetBytes)
+  {
+    factor = std::clamp(std::cbrt(budgetBytes / size), 0.001, 1.0);
+  }
+  this->SetDownsamplingFactor(factor);
+  return true;
+}
@@ -0,0 +1,48 @@
+/**
+ * @class   vtkF3DOpenVDBReader
+ * @brief   VTK OpenVDB reader able to choose its downsampling factor from a memory budget
+ *
+ * Extend vtkOpenVDBReader with the possibility to set the downsampling factor from a memory
+ * budget instead of a fixed value. The memory needed to read the volumes at full resolution is
+ * estimated from the statistics metadata (bounding box, value type) that OpenVDB writes with
+ * each grid, read using openvdb::io::File::readAllGridMetadata without reading any voxel.
+ */
+
+#ifndef vtkF3DOpenVDBReader_h
+#define vtkF3DOpenVDBReader_h
+
+#include <vtkOpenVDBReader.h>
+
+class vtkF3DOpenVDBReader : public vtkOpenVDBReader
+{
+public:
+  static vtkF3DOpenVDBReader* New();
+  vtkTypeMacro(vtkF3DOpenVDBReader, vtkOpenVDBReader);
+
+  /**
+   * Set the downsampling factor so that all volume grids fit in the provided budget in MiB
+   * once converted to images. Full resolution is used when they fit.
+   * The metadata is read from the file name, streams are not supported.
+   * Return false and leave the downsampling factor unchanged if the metadata cannot be read,
+   * eg. when the file was written without statistics.
+   */
+  bool FitDownsamplingFactor(double budget);
+
+  /**
+   * Estimate the size in bytes of the volume grids converted to images at full resolution.
+   * Grids are expected to be merged, see MergeImageVolumes, so the estimate is based on the
+   * union of their bounding boxes.
+   * Return a negative value if the metadata cannot be read.
+   */
+  double EstimateFullResolutionSize();
+
+protected:
+  vtkF3DOpenVDBReader() = default;
+  ~vtkF3DOpenVDBReader() override = default;
+
+private:
+  vtkF3DOpenVDBReader(const vtkF3DOpenVDBReader&) = delete;
+  void operator=(const vtkF3DOpenVDBReader&) = delete;
+};
+
+#endif
@@ -1,6 +1,6 @@
-void applyCustomReader(vtkAlgorithm* algo, const std::string&, vtkResourceStream*) const override
+void applyCustomReader(vtkAlgorithm* algo, const std::string&, vtkResourceStream* stream) const override
 {
-  vtkOpenVDBReader* vdbReader = vtkOpenVDBReader::SafeDownCast(algo);
+  vtkF3DOpenVDBReader* vdbReader = vtkF3DOpenVDBReader::SafeDownCast(algo);
 
   // No check needed, we know the option exists
   std::string optName = "VDB.downsampling_factor";
@@ -10,6 +10,23 @@ void applyCustomReader(vtkAlgorithm* algo, const std::string&, vtkResourceStream
   double dsFactor = F3DUtils::ParseToDouble(dsOptStr, 0.1, optName);
   vdbReader->SetDownsamplingFactor(dsFactor);
 
+  // A memory budget takes precedence over the fixed factor when the grid metadata can be read,
+  // which requires a file
+  std::string budgetOptName = "VDB.memory_budget";
+  double budget = F3DUtils::ParseToDouble(this->ReaderOptions.at(budgetOptName), 0, budgetOptName);
+  if (budget > 0)
+  {
+    if (stream)
+    {
+      vtkWarningWithObjectMacro(
+        nullptr, "VDB.memory_budget is not supported when reading a stream, ignoring it.");
+    }
+    else
+    {
+      vdbReader->FitDownsamplingFactor(budget);
+    }
+  }
+
   // Merge volumes together
   vdbReader->MergeImageVolumesOn();
 }
@@ -445,6 +445,10 @@ PYBIND11_MODULE(pyf3d, module)
       "Add multiple filenames to the scene", py::arg("file_name_vector"))
     .def("add", py::overload_cast<const f3d::mesh_t&>(&f3d::scene::add),
       "Add a surfacic mesh from memory into the scene", py::arg("mesh"))
+    .def("update_mesh",
+      py::overload_cast<std::size_t, const f3d::mesh_t&>(&f3d::scene::updateMesh),
+      "Update the points, normals and texture coordinates of a mesh added from memory",
+      py::arg("index"), py::arg("mesh"))
     .def(
       "add",
       [](f3d::scene& scene, py::bytes buffer, std::size_t size)
@@ -540,6 +544,10 @@ PYBIND11_MODULE(pyf3d, module)
     .def("set_icon", &f3d::window::setIcon,
       "Set the icon of the window using a memory buffer representing a PNG file")
     .def("set_window_name", &f3d::window::setWindowName, "Set the window name")
+    .def("set_render_timings_enabled", &f3d::window::setRenderTimingsEnabled,
+      "Enable or disable the measurement of render timings")
+    .def("get_render_timings", &f3d::window::getRenderTimings,
+      "Get the GPU render timings in milliseconds of the last measured frame")
     .def("get_world_from_display", &f3d::window::getWorldFromDisplay,
       "Get world coordinate point from display coordinate")
     .def("get_display_from_world", &f3d::window::getDisplayFromWorld,
@@ -1,6 +1,8 @@
 import tempfile
 from pathlib import Path
 
+import pytest
+
 import f3d
 
 
@@ -25,6 +27,40 @@ def test_scene_memory():
 
     assert img.compare(f3d.Image(reference)) < 0.05
 
+    # The camera is reset on the center of the bounds of the scene
+    camera = engine.window.camera
+    camera.reset_to_bounds()
+    assert camera.focal_point == pytest.approx((0.5, 0.5, 0.0))
+
+    # Update the points of the mesh in place, faces are kept
+    engine.scene.update_mesh(
+        0, f3d.Mesh(points=[10.0, 0.0, 0.0, 10.0, 2.0, 0.0, 12.0, 0.0, 0.0])
+    )
+    engine.window.render()
+    camera.reset_to_bounds()
+    assert camera.focal_point == pytest.approx((11.0, 1.0, 0.0))
+
+    # Rejected updates leave the mesh unchanged
+    with pytest.raises(RuntimeError):
+        engine.scene.update_mesh(0, f3d.Mesh(points=[0.0, 0.0, 0.0]))
+    with pytest.raises(RuntimeError):
+        engine.scene.update_mesh(
+            0,
+            f3d.Mesh(
+                points=[0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0, 0.0, 0.0],
+                face_sides=[3],
+                face_indices=[0, 1, 2],
+            ),
+        )
+    with pytest.raises(RuntimeError):
+        engine.scene.update_mesh(
+            1, f3d.Mesh(points=[0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0, 0.0, 0.0])
+        )
+
+    engine.window.render()
+    camera.reset_to_bounds()
+    assert camera.focal_point == pytest.approx((11.0, 1.0, 0.0))
+
 
 def test_scene():
     testing_dir = Path(__file__).parent.parent.parent / "testing"
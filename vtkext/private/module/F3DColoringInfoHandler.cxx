@@ -100,6 +100,17 @@ void F3DColoringInfoHandler::UpdateColoringInfo(vtkDataSet* dataset, bool useCel
   }
 }
 
+//----------------------------------------------------------------------------
+void F3DColoringInfoHandler::AddAvailableArrays(
+  const std::vector<std::string>& arrayNames, bool useCellData)
+{
+  auto& data = useCellData ? this->CellDataColoringInfo : this->PointDataColoringInfo;
+  for (const std::string& arrayName : arrayNames)
+  {
+    data[arrayName].Name = arrayName;
+  }
+}
+
 //----------------------------------------------------------------------------
 std::optional<F3DColoringInfoHandler::ColoringInfo> F3DColoringInfoHandler::SetCurrentColoring(
   bool enable, bool useCellData, const std::optional<std::string>& arrayName, bool quiet)
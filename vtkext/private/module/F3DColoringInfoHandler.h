@@ -35,6 +35,13 @@ public:
    */
   void UpdateColoringInfo(vtkDataSet* dataset, bool useCellData);
 
+  /**
+   * Add arrays that are not read yet to the internal coloring maps, so they can be
+   * selected for coloring. Their info is completed when updating with a dataset containing them.
+   * useCellData control if point data or cell data should be updated
+   */
+  void AddAvailableArrays(const std::vector<std::string>& arrayNames, bool useCellData);
+
   /**
    * Clear all internal coloring maps
    */
@@ -0,0 +1,215 @@
+#include "F3DFileHash.h"
+
+#include <vtksys/FStream.hxx>
+#include <vtksys/MD5.h>
+#include <vtksys/SystemTools.hxx>
+
+#include <algorithm>
+#include <filesystem>
+#include <list>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+constexpr std::size_t HashLength = 32;
+
+// Hashes memoized in memory by canonical path, from the least to the most recently hashed path
+struct MemoizedHash
+{
+  std::string Key;
+  std::string Hash;
+  std::list<std::string>::iterator Order;
+};
+std::mutex MemoizedMutex;
+std::unordered_map<std::string, MemoizedHash> Memoized;
+std::list<std::string> MemoizedOrder;
+
+// Serialize the rewrites of the hashes files by the threads of this process
+std::mutex HashesFileMutex;
+
+//----------------------------------------------------------------------------
+// Read the lines of a hashes file, from the least to the most recently hashed path,
+// and retrieve the hash of the line matching the key if any
+std::vector<std::string> ReadHashesLines(
+  const std::string& hashesPath, const std::string& key, std::string& hash)
+{
+  std::vector<std::string> lines;
+  vtksys::ifstream hashesFile(hashesPath.c_str());
+  std::string line;
+  while (std::getline(hashesFile, line))
+  {
+    if (line.size() > HashLength + 1)
+    {
+      if (line.compare(HashLength + 1, std::string::npos, key) == 0)
+      {
+        hash = line.substr(0, HashLength);
+      }
+      lines.emplace_back(std::move(line));
+    }
+  }
+  return lines;
+}
+
+//----------------------------------------------------------------------------
+// Get the path of a "<hash> <size> <mtime> <path>" line
+std::string GetLinePath(const std::string& line)
+{
+  const std::size_t sizeEnd = line.find(' ', HashLength + 1);
+  const std::size_t timeEnd =
+    sizeEnd == std::string::npos ? std::string::npos : line.find(' ', sizeEnd + 1);
+  return timeEnd == std::string::npos ? std::string() : line.substr(timeEnd + 1);
+}
+
+//----------------------------------------------------------------------------
+void Memoize(const std::string& path, const std::string& key, const std::string& hash)
+{
+  std::lock_guard<std::mutex> lock(MemoizedMutex);
+  auto it = Memoized.find(path);
+  if (it != Memoized.end())
+  {
+    MemoizedOrder.erase(it->second.Order);
+    Memoized.erase(it);
+  }
+  while (Memoized.size() >= F3DFileHash::MaxMemoizedHashes)
+  {
+    Memoized.erase(MemoizedOrder.front());
+    MemoizedOrder.pop_front();
+  }
+  auto order = MemoizedOrder.insert(MemoizedOrder.end(), path);
+  Memoized.emplace(path, MemoizedHash{ key, hash, order });
+}
+}
+
+//----------------------------------------------------------------------------
+std::string F3DFileHash::Compute(const std::string& filepath)
+{
+  unsigned char digest[16];
+  char md5Hash[33];
+  md5Hash[32] = '\0';
+
+  constexpr std::size_t chunkSize = 1 << 20;
+  std::vector<char> buffer(chunkSize);
+
+  vtksys::ifstream file;
+  file.open(filepath.c_str(), std::ios_base::binary);
+
+  vtksysMD5* md5 = vtksysMD5_New();
+  vtksysMD5_Initialize(md5);
+  while (file)
+  {
+    file.read(buffer.data(), chunkSize);
+    const std::streamsize count = file.gcount();
+    if (count > 0)
+    {
+      vtksysMD5_Append(
+        md5, reinterpret_cast<const unsigned char*>(buffer.data()), static_cast<int>(count));
+    }
+  }
+  vtksysMD5_Finalize(md5, digest);
+  vtksysMD5_DigestToHex(digest, md5Hash);
+  vtksysMD5_Delete(md5);
+
+  return md5Hash;
+}
+
+//----------------------------------------------------------------------------
+std::string F3DFileHash::Get(const std::string& filepath, const std::string& cachePath)
+{
+  std::error_code ec;
+  const std::uintmax_t size = fs::file_size(filepath, ec);
+  const fs::file_time_type mtime = fs::last_write_time(filepath, ec);
+  const fs::path canonicalPath = ec ? fs::path() : fs::canonical(filepath, ec);
+  if (ec)
+  {
+    return F3DFileHash::Compute(filepath);
+  }
+
+  // Each memoized line is "<hash> <size> <mtime> <path>"
+  const std::string path = canonicalPath.string();
+  const std::string key =
+    std::to_string(size) + " " + std::to_string(mtime.time_since_epoch().count()) + " " + path;
+
+  {
+    std::lock_guard<std::mutex> lock(MemoizedMutex);
+    auto it = Memoized.find(path);
+    if (it != Memoized.end() && it->second.Key == key)
+    {
+      return it->second.Hash;
+    }
+  }
+
+  std::string hash;
+  const std::string hashesPath = cachePath.empty() ? std::string() : cachePath + "/hashes.txt";
+  if (!hashesPath.empty())
+  {
+    std::lock_guard<std::mutex> lock(HashesFileMutex);
+    ::ReadHashesLines(hashesPath, key, hash);
+  }
+
+  if (hash.empty())
+  {
+    // Hashing may take a while on large files, do not block other threads meanwhile
+    hash = F3DFileHash::Compute(filepath);
+
+    if (!hashesPath.empty())
+    {
+      std::lock_guard<std::mutex> lock(HashesFileMutex);
+
+      // Read the file again as it may have been updated while hashing
+      std::string unused;
+      std::vector<std::string> lines = ::ReadHashesLines(hashesPath, key, unused);
+
+      // Replace the outdated lines of this path and drop the least recently hashed paths
+      lines.erase(std::remove_if(lines.begin(), lines.end(),
+                    [&](const std::string& line) { return ::GetLinePath(line) == path; }),
+        lines.end());
+      lines.emplace_back(hash + " " + key);
+      if (lines.size() > F3DFileHash::MaxHashesLines)
+      {
+        lines.erase(lines.begin(),
+          lines.end() - static_cast<std::ptrdiff_t>(F3DFileHash::MaxHashesLines));
+      }
+
+      // Rewrite the file in place once complete, so that it is never read partially written
+      std::random_device rd;
+      const std::string tmpPath =
+        hashesPath + ".tmp" + std::to_string(std::uniform_int_distribution<unsigned int>()(rd));
+      vtksys::SystemTools::MakeDirectory(cachePath);
+      {
+        vtksys::ofstream hashesFile(tmpPath.c_str(), std::ios_base::trunc);
+        for (const std::string& line : lines)
+        {
+          hashesFile << line << "\n";
+        }
+      }
+      fs::rename(tmpPath, hashesPath, ec);
+      if (ec)
+      {
+        fs::remove(tmpPath, ec);
+      }
+    }
+  }
+
+  ::Memoize(path, key, hash);
+  return hash;
+}
+
+//----------------------------------------------------------------------------
+void F3DFileHash::ClearMemoized()
+{
+  std::lock_guard<std::mutex> lock(MemoizedMutex);
+  Memoized.clear();
+  MemoizedOrder.clear();
+}
+
+//----------------------------------------------------------------------------
+std::size_t F3DFileHash::GetNumberOfMemoized()
+{
+  std::lock_guard<std::mutex> lock(MemoizedMutex);
+  return Memoized.size();
+}
@@ -0,0 +1,55 @@
+/**
+ * @class   F3DFileHash
+ * @brief   Namespace containing methods to hash files on disk
+ *
+ * Provide MD5 hashes of files, memoized by canonical path, size and modification time
+ * in memory and, if a cache path is provided, in a "hashes.txt" file so that known files
+ * are not read again. Methods are thread safe.
+ *
+ */
+
+#ifndef F3DFileHash_h
+#define F3DFileHash_h
+
+#include <cstddef>
+#include <string>
+
+namespace F3DFileHash
+{
+/**
+ * Maximum number of lines kept in the "hashes.txt" file,
+ * the least recently hashed paths are dropped first.
+ */
+constexpr std::size_t MaxHashesLines = 1000;
+
+/**
+ * Maximum number of hashes memoized in memory,
+ * the least recently hashed paths are dropped first.
+ */
+constexpr std::size_t MaxMemoizedHashes = 1000;
+
+/**
+ * Compute the MD5 hash of an existing file on disk, reading it by chunks.
+ */
+std::string Compute(const std::string& filepath);
+
+/**
+ * Get the MD5 hash of an existing file on disk, from the memoized hashes if the file is known
+ * and unchanged, computing it otherwise.
+ * If cachePath is not empty, the "hashes.txt" file it contains is looked up and updated.
+ * The file keeps a single line per path and only the MaxHashesLines most recently hashed paths.
+ */
+std::string Get(const std::string& filepath, const std::string& cachePath);
+
+/**
+ * Clear the hashes memoized in memory, the "hashes.txt" files are not modified.
+ */
+void ClearMemoized();
+
+/**
+ * Get the number of hashes memoized in memory.
+ */
+std::size_t GetNumberOfMemoized();
+}
+
+#endif
@@ -5,16 +5,38 @@
 #include <vtkCallbackCommand.h>
 #include <vtkNew.h>
 
+#include <mutex>
+#include <vector>
+
 // extern variables
 F3DLog::Severity F3DLog::VerboseLevel = F3DLog::Severity::Info;
 std::function<void(F3DLog::Severity, const std::string&)> F3DLog::Forwarder;
 
+namespace
+{
+// Readers may print from worker threads, the forwarder is called by a single thread at a time
+std::recursive_mutex ForwarderMutex;
+
+thread_local bool DeferCurrentThread = false;
+std::mutex DeferredMutex;
+std::vector<std::function<void()>> Deferred;
+}
+
 //----------------------------------------------------------------------------
 void F3DLog::Print(Severity sev, const std::string& str)
 {
-  if (F3DLog::Forwarder)
+  if (DeferCurrentThread)
+  {
+    F3DLog::QueueDeferred([sev, str]() { F3DLog::Print(sev, str); });
+    return;
+  }
+
   {
-    F3DLog::Forwarder(sev, str);
+    std::lock_guard<std::recursive_mutex> lock(ForwarderMutex);
+    if (F3DLog::Forwarder)
+    {
+      F3DLog::Forwarder(sev, str);
+    }
   }
 
   vtkOutputWindow* win = vtkOutputWindow::GetInstance();
@@ -82,5 +104,39 @@ void F3DLog::SetStandardStream(StandardStream mode)
 //----------------------------------------------------------------------------
 void F3DLog::Forward(std::function<void(Severity, const std::string&)> userCallback)
 {
+  std::lock_guard<std::recursive_mutex> lock(ForwarderMutex);
   F3DLog::Forwarder = std::move(userCallback);
 }
+
+//----------------------------------------------------------------------------
+void F3DLog::SetDeferCurrentThread(bool defer)
+{
+  DeferCurrentThread = defer;
+}
+
+//----------------------------------------------------------------------------
+bool F3DLog::IsCurrentThreadDeferred()
+{
+  return DeferCurrentThread;
+}
+
+//----------------------------------------------------------------------------
+void F3DLog::QueueDeferred(std::function<void()> display)
+{
+  std::lock_guard<std::mutex> lock(DeferredMutex);
+  Deferred.emplace_back(std::move(display));
+}
+
+//----------------------------------------------------------------------------
+void F3DLog::FlushDeferred()
+{
+  std::vector<std::function<void()>> deferred;
+  {
+    std::lock_guard<std::mutex> lock(DeferredMutex);
+    deferred.swap(Deferred);
+  }
+  for (const std::function<void()>& display : deferred)
+  {
+    display();
+  }
+}
@@ -58,6 +58,30 @@ void SetUseColoring(bool use);
  */
 void SetStandardStream(StandardStream mode);
 
+/**
+ * Set if the messages printed by the calling thread are deferred, false by default.
+ * Deferred messages, including VTK messages displayed through vtkF3DConsoleOutputWindow,
+ * are queued and only displayed when FlushDeferred is called, so worker threads never
+ * display messages while the main thread renders.
+ */
+void SetDeferCurrentThread(bool defer);
+
+/**
+ * Return true if the messages printed by the calling thread are deferred.
+ */
+bool IsCurrentThreadDeferred();
+
+/**
+ * Queue a function displaying a deferred message.
+ */
+void QueueDeferred(std::function<void()> display);
+
+/**
+ * Display all the deferred messages, in order.
+ * Must be called from the main thread.
+ */
+void FlushDeferred();
+
 /**
  * Callback function for forwarding log messages.
  * If set, it will be invoked with the message string whenever a log message is printed.
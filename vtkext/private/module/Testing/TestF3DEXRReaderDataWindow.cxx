@@ -0,0 +1,50 @@
+#include <vtkFloatArray.h>
+#include <vtkImageData.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+
+#include "vtkF3DEXRReader.h"
+
+#include <iostream>
+
+int TestF3DEXRReaderDataWindow(int argc, char* argv[])
+{
+  // 20x150 image with a data window starting at (5, 7), read in several chunks of scanlines.
+  // Red is the column and green the row of the pixel in the data window, blue is 1
+  vtkNew<vtkF3DEXRReader> reader;
+  std::string filename = std::string(argv[1]) + "data/data_window_origin.exr";
+  reader->SetFileName(filename.c_str());
+  reader->Update();
+
+  vtkImageData* img = reader->GetOutput();
+  const int* extent = img->GetExtent();
+  if (extent[0] != 5 || extent[1] != 24 || extent[2] != 7 || extent[3] != 156)
+  {
+    std::cerr << "Incorrect EXR image extent.\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkFloatArray* scalars = vtkFloatArray::SafeDownCast(img->GetPointData()->GetScalars());
+  if (!scalars || scalars->GetNumberOfComponents() != 3 || scalars->GetNumberOfTuples() != 3000)
+  {
+    std::cerr << "Incorrect EXR image scalars.\n";
+    return EXIT_FAILURE;
+  }
+
+  // EXR scanlines are stored from top to bottom, VTK rows from bottom to top
+  for (int row = 0; row < 150; row++)
+  {
+    for (int col = 0; col < 20; col++)
+    {
+      float pixel[3];
+      scalars->GetTypedTuple(row * 20 + col, pixel);
+      if (pixel[0] != col || pixel[1] != 149 - row || pixel[2] != 1.f)
+      {
+        std::cerr << "Incorrect EXR pixel value at " << col << ", " << row << ".\n";
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
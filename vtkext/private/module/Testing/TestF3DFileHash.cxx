@@ -0,0 +1,139 @@
+#include "F3DFileHash.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+void WriteFile(const fs::path& path, const std::string& content)
+{
+  std::ofstream file(path, std::ios_base::binary | std::ios_base::trunc);
+  file << content;
+}
+
+std::vector<std::string> ReadLines(const fs::path& path)
+{
+  std::vector<std::string> lines;
+  std::ifstream file(path);
+  std::string line;
+  while (std::getline(file, line))
+  {
+    lines.emplace_back(line);
+  }
+  return lines;
+}
+}
+
+int TestF3DFileHash(int argc, char* argv[])
+{
+  const fs::path dir = fs::path(argv[2]) / "TestF3DFileHash";
+  const fs::path cachePath = dir / "cache";
+  const fs::path hashesPath = cachePath / "hashes.txt";
+  fs::remove_all(dir);
+  fs::create_directories(dir);
+  F3DFileHash::ClearMemoized();
+
+  const fs::path file = dir / "file.txt";
+  const std::string filePath = file.string();
+  const std::string helloHash = "5d41402abc4b2a76b9719d911017c592";
+  ::WriteFile(file, "hello");
+
+  if (F3DFileHash::Compute(filePath) != helloHash)
+  {
+    std::cerr << "Unexpected computed hash\n";
+    return EXIT_FAILURE;
+  }
+
+  // Cache miss, the hash is computed and written in the hashes file
+  if (F3DFileHash::Get(filePath, cachePath.string()) != helloHash)
+  {
+    std::cerr << "Unexpected hash on cache miss\n";
+    return EXIT_FAILURE;
+  }
+
+  std::vector<std::string> lines = ::ReadLines(hashesPath);
+  if (lines.size() != 1 || lines[0].compare(0, helloHash.size(), helloHash) != 0)
+  {
+    std::cerr << "Hash not written in the hashes file\n";
+    return EXIT_FAILURE;
+  }
+
+  // Cache hit from the hashes file, the file is not hashed again
+  const std::string fakeHash(32, '0');
+  F3DFileHash::ClearMemoized();
+  ::WriteFile(hashesPath, fakeHash + lines[0].substr(fakeHash.size()) + "\n");
+  if (F3DFileHash::Get(filePath, cachePath.string()) != fakeHash)
+  {
+    std::cerr << "Hash not read from the hashes file\n";
+    return EXIT_FAILURE;
+  }
+
+  // Cache hit from memory, the hashes file is not read again
+  fs::remove(hashesPath);
+  if (F3DFileHash::Get(filePath, cachePath.string()) != fakeHash ||
+    F3DFileHash::GetNumberOfMemoized() != 1 || fs::exists(hashesPath))
+  {
+    std::cerr << "Hash not memoized in memory\n";
+    return EXIT_FAILURE;
+  }
+
+  // Cache miss when the file changes, its line is replaced
+  const std::string helloWorldHash = "5eb63bbbe01eeed093cb22bb8f5acdc3";
+  ::WriteFile(hashesPath, fakeHash + lines[0].substr(fakeHash.size()) + "\n");
+  ::WriteFile(file, "hello world");
+  if (F3DFileHash::Get(filePath, cachePath.string()) != helloWorldHash)
+  {
+    std::cerr << "Unexpected hash of a modified file\n";
+    return EXIT_FAILURE;
+  }
+
+  lines = ::ReadLines(hashesPath);
+  if (lines.size() != 1 || lines[0].compare(0, helloWorldHash.size(), helloWorldHash) != 0 ||
+    F3DFileHash::GetNumberOfMemoized() != 1)
+  {
+    std::cerr << "Outdated hash not replaced\n";
+    return EXIT_FAILURE;
+  }
+
+  // The least recently hashed paths are dropped from the hashes file and from memory
+  const std::size_t count = F3DFileHash::MaxHashesLines;
+  for (std::size_t i = 0; i < count; i++)
+  {
+    const fs::path other = dir / ("file" + std::to_string(i) + ".txt");
+    ::WriteFile(other, std::to_string(i));
+    F3DFileHash::Get(other.string(), cachePath.string());
+  }
+
+  lines = ::ReadLines(hashesPath);
+  const std::string lastPath = fs::canonical(dir / ("file" + std::to_string(count - 1) + ".txt"))
+                                 .string();
+  if (lines.size() != F3DFileHash::MaxHashesLines ||
+    lines.front().compare(0, helloWorldHash.size(), helloWorldHash) == 0 ||
+    lines.back().compare(lines.back().size() - lastPath.size(), lastPath.size(), lastPath) != 0)
+  {
+    std::cerr << "Hashes file not compacted: " << lines.size() << " lines\n";
+    return EXIT_FAILURE;
+  }
+
+  if (F3DFileHash::GetNumberOfMemoized() != F3DFileHash::MaxMemoizedHashes)
+  {
+    std::cerr << "Memoized hashes not pruned: " << F3DFileHash::GetNumberOfMemoized() << "\n";
+    return EXIT_FAILURE;
+  }
+
+  // The dropped path is hashed again
+  F3DFileHash::ClearMemoized();
+  if (F3DFileHash::Get(filePath, cachePath.string()) != helloWorldHash ||
+    ::ReadLines(hashesPath).back().compare(0, helloWorldHash.size(), helloWorldHash) != 0)
+  {
+    std::cerr << "Dropped hash not computed again\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,110 @@
+#include <vtkActor.h>
+#include <vtkCamera.h>
+#include <vtkNew.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderWindowInteractor.h>
+#include <vtkRenderer.h>
+#include <vtkSphereSource.h>
+
+#include "vtkF3DFrustumCuller.h"
+
+#include <array>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+/**
+ * Cull a copy of the props and return the props that are not culled
+ */
+std::vector<vtkProp*> Cull(vtkF3DFrustumCuller* culler, vtkRenderer* renderer,
+  const std::vector<vtkProp*>& props)
+{
+  std::vector<vtkProp*> list = props;
+  int length = static_cast<int>(list.size());
+  int initialized = 0;
+  culler->Cull(renderer, list.data(), length, initialized);
+  list.resize(length);
+  return list;
+}
+}
+
+int TestF3DFrustumCuller(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
+{
+  vtkNew<vtkSphereSource> source;
+  std::array<vtkNew<vtkPolyDataMapper>, 3> mappers;
+  std::array<vtkNew<vtkActor>, 3> actors;
+  for (size_t i = 0; i < actors.size(); i++)
+  {
+    mappers[i]->SetInputConnection(source->GetOutputPort());
+    actors[i]->SetMapper(mappers[i]);
+  }
+
+  // actors[0] is visible, actors[1] is out of view, actors[2] is out of view but not cullable
+  actors[1]->SetPosition(1000, 0, 0);
+  actors[2]->SetPosition(1000, 0, 0);
+  actors[2]->UseBoundsOff();
+
+  vtkNew<vtkRenderer> renderer;
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetSize(300, 300);
+  renWin->AddRenderer(renderer);
+  renderer->GetActiveCamera()->SetPosition(0, 0, 5);
+  renderer->GetActiveCamera()->SetFocalPoint(0, 0, 0);
+  renderer->SetAspect(1, 1);
+
+  vtkNew<vtkF3DFrustumCuller> culler;
+  culler->Print(std::cout);
+
+  std::vector<vtkProp*> props = { actors[0], actors[1], actors[2] };
+  std::vector<vtkProp*> kept = ::Cull(culler, renderer, props);
+  if (kept != std::vector<vtkProp*>{ actors[0], actors[2] } ||
+    culler->GetNumberOfCulledProps() != 1)
+  {
+    std::cerr << "Only the actor out of view should be culled\n";
+    return EXIT_FAILURE;
+  }
+
+  // Cached bounds are recomputed when the actor is modified
+  actors[1]->SetPosition(0, 0, 0);
+  kept = ::Cull(culler, renderer, props);
+  if (kept != props)
+  {
+    std::cerr << "No actor should be culled after moving the actor in view\n";
+    return EXIT_FAILURE;
+  }
+
+  // Cached bounds are recomputed when the source is modified, before it is updated
+  source->SetCenter(1000, 0, 0);
+  kept = ::Cull(culler, renderer, props);
+  if (kept != std::vector<vtkProp*>{ actors[2] } || culler->GetNumberOfCulledProps() != 2)
+  {
+    std::cerr << "Actors should be culled after moving their source out of view\n";
+    return EXIT_FAILURE;
+  }
+  source->SetCenter(0, 0, 0);
+
+  // Small actors are only culled while interacting
+  source->SetRadius(0.001);
+  source->Update();
+  culler->SetMinimumInteractionSize(5.0);
+  kept = ::Cull(culler, renderer, props);
+  if (kept != props)
+  {
+    std::cerr << "Small actors should not be culled when not interacting\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkRenderWindowInteractor> interactor;
+  renWin->SetInteractor(interactor);
+  renWin->SetDesiredUpdateRate(interactor->GetDesiredUpdateRate());
+  kept = ::Cull(culler, renderer, props);
+  if (kept != std::vector<vtkProp*>{ actors[2] } || culler->GetNumberOfCulledProps() != 2)
+  {
+    std::cerr << "Small actors should be culled while interacting\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,26 @@
+#include "vtkF3DGPUTimer.h"
+
+#include <vtkNew.h>
+
+#include <iostream>
+
+int TestF3DGPUTimer(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
+{
+  vtkNew<vtkF3DGPUTimer> timer;
+
+  // Sections are ignored when no frame is measured, which does not need an OpenGL context
+  timer->StartSection("Section");
+  timer->StopSection("Section");
+  timer->StopFrame();
+  {
+    vtkF3DGPUTimer::ScopedSection section(nullptr, "Scoped");
+  }
+
+  if (!timer->GetTimings().empty())
+  {
+    std::cerr << "No timings should be available when no frame has been measured\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
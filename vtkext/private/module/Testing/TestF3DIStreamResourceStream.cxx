@@ -0,0 +1,147 @@
+#include "vtkF3DIStreamResourceStream.h"
+
+#include <vtkNew.h>
+
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+// A stream buffer that cannot seek, like a pipe
+class PipeBuffer : public std::streambuf
+{
+public:
+  explicit PipeBuffer(std::string content)
+    : Content(std::move(content))
+  {
+    this->setg(this->Content.data(), this->Content.data(),
+      this->Content.data() + this->Content.size());
+  }
+
+private:
+  std::string Content;
+};
+
+bool CheckRead(vtkF3DIStreamResourceStream* stream, std::size_t bytes, const std::string& expected)
+{
+  std::string read(bytes, '\0');
+  read.resize(stream->Read(read.data(), bytes));
+  if (read != expected)
+  {
+    std::cerr << "Read \"" << read << "\" instead of \"" << expected << "\"\n";
+    return false;
+  }
+  return true;
+}
+
+bool TestStream(std::istream& input, bool buffering, const std::string& spillDirectory = "")
+{
+  vtkNew<vtkF3DIStreamResourceStream> stream;
+  stream->SetSpillDirectory(spillDirectory);
+  stream->SetSpillThreshold(5);
+  stream->SetInput(&input);
+
+  if (stream->IsBuffering() != buffering)
+  {
+    std::cerr << "Unexpected buffering status\n";
+    return false;
+  }
+
+  if (!::CheckRead(stream, 4, "0123") || stream->Tell() != 4 || stream->EndOfStream())
+  {
+    return false;
+  }
+
+  // Seek backward and read both already read and new content
+  if (stream->Seek(2, vtkResourceStream::SeekDirection::Begin) != 2 ||
+    !::CheckRead(stream, 4, "2345"))
+  {
+    std::cerr << "Failed to seek backward\n";
+    return false;
+  }
+
+  // Seek forward
+  if (stream->Seek(2, vtkResourceStream::SeekDirection::Current) != 8 ||
+    !::CheckRead(stream, 1, "8"))
+  {
+    std::cerr << "Failed to seek forward\n";
+    return false;
+  }
+
+  // Seek relative to the end and read past it
+  if (stream->Seek(-2, vtkResourceStream::SeekDirection::End) != 8 ||
+    !::CheckRead(stream, 4, "89") || !stream->EndOfStream())
+  {
+    std::cerr << "Failed to seek from the end\n";
+    return false;
+  }
+
+  // Read again from the beginning
+  if (stream->Seek(0, vtkResourceStream::SeekDirection::Begin) != 0 ||
+    !::CheckRead(stream, 10, "0123456789") || !stream->EndOfStream())
+  {
+    std::cerr << "Failed to read again from the beginning\n";
+    return false;
+  }
+
+  if (!spillDirectory.empty() && fs::is_empty(spillDirectory))
+  {
+    std::cerr << "Content was not spilled\n";
+    return false;
+  }
+  return true;
+}
+}
+
+int TestF3DIStreamResourceStream(int vtkNotUsed(argc), char* argv[])
+{
+  std::istringstream seekable("0123456789");
+  if (!::TestStream(seekable, false))
+  {
+    std::cerr << "Seekable input stream failed\n";
+    return EXIT_FAILURE;
+  }
+
+  // The stream starts at the current position of the input
+  std::istringstream offset("xx0123456789");
+  offset.ignore(2);
+  if (!::TestStream(offset, false))
+  {
+    std::cerr << "Seekable input stream with an offset failed\n";
+    return EXIT_FAILURE;
+  }
+
+  ::PipeBuffer buffer("0123456789");
+  std::istream pipe(&buffer);
+  if (!::TestStream(pipe, true))
+  {
+    std::cerr << "Input stream that cannot seek failed\n";
+    return EXIT_FAILURE;
+  }
+
+  // Content is moved into a spill file once larger than the threshold
+  const fs::path spillDirectory = fs::path(argv[2]) / "TestF3DIStreamResourceStream";
+  fs::remove_all(spillDirectory);
+  fs::create_directories(spillDirectory);
+  ::PipeBuffer spillBuffer("0123456789");
+  std::istream spillPipe(&spillBuffer);
+  if (!::TestStream(spillPipe, true, spillDirectory.string()))
+  {
+    std::cerr << "Input stream that cannot seek with a spill directory failed\n";
+    return EXIT_FAILURE;
+  }
+
+  // The spill file is removed with the stream
+  if (!fs::is_empty(spillDirectory))
+  {
+    std::cerr << "Spill file not removed\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
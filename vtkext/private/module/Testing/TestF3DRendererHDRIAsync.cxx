@@ -0,0 +1,80 @@
+#include <vtkNew.h>
+#include <vtkRenderWindow.h>
+
+#include "vtkF3DMetaImporter.h"
+#include "vtkF3DRenderer.h"
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+int TestF3DRendererHDRIAsync(int argc, char* argv[])
+{
+  vtkNew<vtkF3DRenderer> renderer;
+  vtkNew<vtkF3DMetaImporter> importer;
+  vtkNew<vtkRenderWindow> window;
+
+  window->AddRenderer(renderer);
+  window->OffScreenRenderingOn();
+  importer->SetRenderWindow(window);
+  renderer->SetImporter(importer);
+
+  // Create the OpenGL context needed to configure the HDRI textures
+  window->Render();
+
+  const fs::path cachePath = fs::path(argv[2]) / "TestF3DRendererHDRIAsync";
+  fs::remove_all(cachePath);
+  renderer->SetCachePath(cachePath.string());
+  renderer->SetUseImageBasedLighting(true);
+  renderer->SetHDRIAsyncPreparation(true);
+  renderer->SetHDRIFile(fs::path(argv[1]) / "data/palermo_park_1k.hdr");
+
+  // The default HDRI is used while the HDRI is prepared in the background
+  renderer->UpdateActors();
+  window->Render();
+
+  const auto start = std::chrono::steady_clock::now();
+  while (!renderer->IsHDRIPreparationReady())
+  {
+    if (std::chrono::steady_clock::now() - start > std::chrono::minutes(1))
+    {
+      std::cerr << "HDRI preparation did not finish\n";
+      return EXIT_FAILURE;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  // Swap in the prepared HDRI
+  renderer->UpdateActors();
+  window->Render();
+
+  if (renderer->IsHDRIPreparationReady())
+  {
+    std::cerr << "Prepared HDRI was not swapped in\n";
+    return EXIT_FAILURE;
+  }
+
+  // Cache files written by the background thread and the render are in place and complete
+  int shCount = 0;
+  for (const fs::directory_entry& entry : fs::recursive_directory_iterator(cachePath))
+  {
+    const std::string name = entry.path().filename().string();
+    if (name.find(".tmp") != std::string::npos)
+    {
+      std::cerr << "Temporary cache file left: " << entry.path() << "\n";
+      return EXIT_FAILURE;
+    }
+    shCount += name == "sh.vtt" ? 1 : 0;
+  }
+
+  if (shCount != 1 || !fs::exists(cachePath / "lut.vti"))
+  {
+    std::cerr << "HDRI cache files not written\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -1,8 +1,11 @@
 #include "vtkF3DConsoleOutputWindow.h"
 
+#include "F3DLog.h"
+
 #include <vtkObjectFactory.h>
 
 #include <iostream>
+#include <string>
 
 vtkStandardNewMacro(vtkF3DConsoleOutputWindow);
 
@@ -12,6 +15,8 @@ vtkF3DConsoleOutputWindow::vtkF3DConsoleOutputWindow() = default;
 //----------------------------------------------------------------------------
 void vtkF3DConsoleOutputWindow::DisplayText(const char* txt)
 {
+  std::lock_guard<std::recursive_mutex> lock(this->DisplayMutex);
+
   std::string fmtText;
 
   if (this->UseColoring)
@@ -54,3 +59,59 @@ void vtkF3DConsoleOutputWindow::DisplayText(const char* txt)
       break;
   }
 }
+
+//----------------------------------------------------------------------------
+void vtkF3DConsoleOutputWindow::DisplayErrorText(const char* txt)
+{
+  if (F3DLog::IsCurrentThreadDeferred())
+  {
+    F3DLog::QueueDeferred([text = std::string(txt)]()
+      { vtkOutputWindow::GetInstance()->DisplayErrorText(text.c_str()); });
+    return;
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(this->DisplayMutex);
+  this->Superclass::DisplayErrorText(txt);
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DConsoleOutputWindow::DisplayWarningText(const char* txt)
+{
+  if (F3DLog::IsCurrentThreadDeferred())
+  {
+    F3DLog::QueueDeferred([text = std::string(txt)]()
+      { vtkOutputWindow::GetInstance()->DisplayWarningText(text.c_str()); });
+    return;
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(this->DisplayMutex);
+  this->Superclass::DisplayWarningText(txt);
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DConsoleOutputWindow::DisplayGenericWarningText(const char* txt)
+{
+  if (F3DLog::IsCurrentThreadDeferred())
+  {
+    F3DLog::QueueDeferred([text = std::string(txt)]()
+      { vtkOutputWindow::GetInstance()->DisplayGenericWarningText(text.c_str()); });
+    return;
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(this->DisplayMutex);
+  this->Superclass::DisplayGenericWarningText(txt);
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DConsoleOutputWindow::DisplayDebugText(const char* txt)
+{
+  if (F3DLog::IsCurrentThreadDeferred())
+  {
+    F3DLog::QueueDeferred([text = std::string(txt)]()
+      { vtkOutputWindow::GetInstance()->DisplayDebugText(text.c_str()); });
+    return;
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(this->DisplayMutex);
+  this->Superclass::DisplayDebugText(txt);
+}
@@ -10,6 +10,8 @@
 
 #include <vtkCommand.h>
 
+#include <mutex>
+
 class vtkF3DConsoleOutputWindow : public vtkOutputWindow
 {
 public:
@@ -31,6 +33,17 @@ public:
    */
   void DisplayText(const char*) override;
 
+  //@{
+  /**
+   * Reimplemented to serialize messages logged from several threads,
+   * so the type and text of a message are not mixed with another one.
+   */
+  void DisplayErrorText(const char*) override;
+  void DisplayWarningText(const char*) override;
+  void DisplayGenericWarningText(const char*) override;
+  void DisplayDebugText(const char*) override;
+  //@}
+
   //@{
   /**
    * Set/Get the coloring usage.
@@ -47,6 +60,8 @@ protected:
   vtkF3DConsoleOutputWindow();
   ~vtkF3DConsoleOutputWindow() override = default;
 
+  std::recursive_mutex DisplayMutex;
+
 private:
   bool UseColoring = true;
 };
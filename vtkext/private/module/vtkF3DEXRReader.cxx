@@ -14,9 +14,22 @@
 #include <ImfRgbaFile.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <sstream>
 #include <thread>
 
+namespace
+{
+// Number of scanlines read at once, only this many rows are held in EXR pixel format
+constexpr int ChunkHeight = 64;
+
+//------------------------------------------------------------------------------
+float ClampValue(const Imath::half& value)
+{
+  return std::clamp(static_cast<float>(value), 0.f, 10000.f);
+}
+}
+
 /**
  * Class implementing a memory stream for OpenEXR
  */
@@ -199,20 +212,33 @@ void vtkF3DEXRReader::ExecuteDataWithInformation(vtkDataObject* output, vtkInfor
 
   auto readContent = [&](Imf::RgbaInputFile& file)
   {
-    Imf::Array2D<Imf::Rgba> pixels(this->GetHeight(), this->GetWidth());
-
-    file.setFrameBuffer(&pixels[0][0], 1, this->GetWidth());
-    file.readPixels(this->DataExtent[2], this->DataExtent[3]);
+    const int width = this->GetWidth();
+    const int chunkHeight = std::min(this->GetHeight(), ::ChunkHeight);
+    Imf::Array2D<Imf::Rgba> chunk(chunkHeight, width);
 
-    for (int y = this->GetHeight() - 1; y >= 0; y--)
+    // Read by chunks of scanlines and convert them straight into the output scalars
+    for (int y0 = this->DataExtent[2]; y0 <= this->DataExtent[3]; y0 += chunkHeight)
     {
-      for (int x = 0; x < this->GetWidth(); x++)
+      const int y1 = std::min(y0 + chunkHeight - 1, this->DataExtent[3]);
+
+      // The frame buffer is addressed using data window coordinates
+      file.setFrameBuffer(
+        &chunk[0][0] - this->DataExtent[0] - static_cast<std::ptrdiff_t>(y0) * width, 1, width);
+      file.readPixels(y0, y1);
+
+      for (int y = y0; y <= y1; y++)
       {
-        const Imf::Rgba& p = pixels[y][x];
-        dataPtr[0] = std::clamp(static_cast<float>(p.r), 0.f, 10000.f);
-        dataPtr[1] = std::clamp(static_cast<float>(p.g), 0.f, 10000.f);
-        dataPtr[2] = std::clamp(static_cast<float>(p.b), 0.f, 10000.f);
-        dataPtr += 3;
+        // EXR scanlines are stored from top to bottom
+        const Imf::Rgba* pixels = chunk[y - y0];
+        const size_t offset = static_cast<size_t>(this->DataExtent[3] - y) * width * 3;
+        for (int x = 0; x < width; x++)
+        {
+          const Imf::Rgba& p = pixels[x];
+          const size_t index = offset + static_cast<size_t>(x) * 3;
+          dataPtr[index] = ::ClampValue(p.r);
+          dataPtr[index + 1] = ::ClampValue(p.g);
+          dataPtr[index + 2] = ::ClampValue(p.b);
+        }
       }
     }
   };
@@ -0,0 +1,253 @@
+#include "vtkF3DFrustumCuller.h"
+
+#include <vtkAbstractVolumeMapper.h>
+#include <vtkActor.h>
+#include <vtkCamera.h>
+#include <vtkDataObject.h>
+#include <vtkMapper.h>
+#include <vtkMath.h>
+#include <vtkObjectFactory.h>
+#include <vtkPointGaussianMapper.h>
+#include <vtkProp3D.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderWindowInteractor.h>
+#include <vtkRenderer.h>
+#include <vtkVolume.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+/**
+ * Return the mapper of an actor or a volume, nullptr for other props
+ */
+vtkAbstractMapper3D* GetMapper(vtkProp3D* prop)
+{
+  if (vtkActor* actor = vtkActor::SafeDownCast(prop))
+  {
+    return actor->GetMapper();
+  }
+  if (vtkVolume* volume = vtkVolume::SafeDownCast(prop))
+  {
+    return volume->GetMapper();
+  }
+  return nullptr;
+}
+
+/**
+ * Return the modification time of an algorithm, of its inputs and of the algorithms upstream,
+ * so that changes of a producer connected with SetInputConnection are seen before it updates
+ */
+vtkMTimeType GetUpstreamMTime(vtkAlgorithm* algorithm)
+{
+  vtkMTimeType mtime = algorithm->GetMTime();
+  for (int port = 0; port < algorithm->GetNumberOfInputPorts(); port++)
+  {
+    for (int connection = 0; connection < algorithm->GetNumberOfInputConnections(port);
+         connection++)
+    {
+      vtkAlgorithm* producer = algorithm->GetInputAlgorithm(port, connection);
+      if (producer)
+      {
+        mtime = std::max(mtime, ::GetUpstreamMTime(producer));
+      }
+      vtkDataObject* input = algorithm->GetInputDataObject(port, connection);
+      if (input)
+      {
+        mtime = std::max(mtime, input->GetMTime());
+      }
+    }
+  }
+  return mtime;
+}
+
+/**
+ * Return the modification time the world bounds of a prop depend on
+ */
+vtkMTimeType GetBoundsMTime(vtkProp3D* prop, vtkAbstractMapper3D* mapper)
+{
+  return std::max(prop->GetMTime(), ::GetUpstreamMTime(mapper));
+}
+
+/**
+ * Return true if the renderer is being interacted with, ie: the interactor style is in an
+ * interaction state, which increases the desired update rate of the render window
+ */
+bool IsInteracting(vtkRenderer* ren)
+{
+  vtkRenderWindow* renWin = ren->GetRenderWindow();
+  vtkRenderWindowInteractor* interactor = renWin ? renWin->GetInteractor() : nullptr;
+  return interactor && renWin->GetDesiredUpdateRate() > interactor->GetStillUpdateRate();
+}
+}
+
+struct vtkF3DFrustumCuller::Internals
+{
+  struct CachedBounds
+  {
+    vtkMTimeType MTime = 0;
+    std::array<double, 6> Bounds;
+    bool Valid = false;
+    unsigned int CullIndex = 0;
+  };
+
+  std::unordered_map<vtkProp*, CachedBounds> Cache;
+  std::vector<vtkProp*> CulledProps;
+
+  // Index of the current call to Cull, entries not used by it are dropped
+  unsigned int CullIndex = 0;
+
+  /**
+   * Get the world bounds of a cullable prop, recomputing them only if needed.
+   * Return nullptr if the prop cannot be culled.
+   */
+  const double* GetBounds(vtkProp* prop)
+  {
+    vtkProp3D* prop3D = vtkProp3D::SafeDownCast(prop);
+    if (!prop3D || !prop3D->GetUseBounds())
+    {
+      return nullptr;
+    }
+
+    vtkAbstractMapper3D* mapper = ::GetMapper(prop3D);
+    if (!mapper || vtkPointGaussianMapper::SafeDownCast(mapper))
+    {
+      return nullptr;
+    }
+
+    vtkMTimeType mtime = ::GetBoundsMTime(prop3D, mapper);
+    CachedBounds& cached = this->Cache[prop];
+    cached.CullIndex = this->CullIndex;
+    if (cached.MTime != mtime)
+    {
+      const double* bounds = prop3D->GetBounds();
+      cached.Valid = bounds && vtkMath::AreBoundsInitialized(bounds);
+      if (cached.Valid)
+      {
+        std::copy(bounds, bounds + 6, cached.Bounds.begin());
+      }
+      cached.MTime = mtime;
+    }
+    return cached.Valid ? cached.Bounds.data() : nullptr;
+  }
+};
+
+vtkStandardNewMacro(vtkF3DFrustumCuller);
+
+//----------------------------------------------------------------------------
+vtkF3DFrustumCuller::vtkF3DFrustumCuller()
+  : Pimpl(new Internals())
+{
+}
+
+//----------------------------------------------------------------------------
+vtkF3DFrustumCuller::~vtkF3DFrustumCuller() = default;
+
+//----------------------------------------------------------------------------
+double vtkF3DFrustumCuller::Cull(
+  vtkRenderer* ren, vtkProp** propList, int& listLength, int& initialized)
+{
+  Internals& pimpl = *this->Pimpl;
+  vtkCamera* camera = ren->GetActiveCamera();
+
+  // Planes normals point inward, in the following order: left, right, bottom, top, far, near
+  double aspect[2];
+  ren->GetAspect(aspect);
+  double planes[24];
+  camera->GetFrustumPlanes(aspect[0] / aspect[1], planes);
+
+  const bool cullSmall = this->MinimumInteractionSize > 0.0 && ::IsInteracting(ren);
+  const double* position = camera->GetPosition();
+  double direction[3];
+  camera->GetDirectionOfProjection(direction);
+  const double tanHalfAngle = std::tan(vtkMath::RadiansFromDegrees(camera->GetViewAngle()) / 2.0);
+  const int height = ren->GetSize()[1];
+
+  pimpl.CulledProps.clear();
+  pimpl.CullIndex++;
+  double totalTime = 0.0;
+  int keptLength = 0;
+  for (int i = 0; i < listLength; i++)
+  {
+    vtkProp* prop = propList[i];
+    const double* bounds = pimpl.GetBounds(prop);
+
+    bool culled = false;
+    if (bounds)
+    {
+      // The box is outside if its corner the furthest along a plane normal is behind the plane
+      for (int p = 0; p < 6 && !culled; p++)
+      {
+        const double* plane = planes + 4 * p;
+        const double x = plane[0] >= 0 ? bounds[1] : bounds[0];
+        const double y = plane[1] >= 0 ? bounds[3] : bounds[2];
+        const double z = plane[2] >= 0 ? bounds[5] : bounds[4];
+        culled = plane[0] * x + plane[1] * y + plane[2] * z + plane[3] < 0.0;
+      }
+
+      if (!culled && cullSmall)
+      {
+        const double center[3] = { (bounds[0] + bounds[1]) / 2.0, (bounds[2] + bounds[3]) / 2.0,
+          (bounds[4] + bounds[5]) / 2.0 };
+        const double radius = std::sqrt(vtkMath::Distance2BetweenPoints(bounds, bounds + 3) / 4.0);
+
+        // Diameter of the bounding sphere projected on screen, in pixels
+        double halfExtent = camera->GetParallelScale();
+        if (!camera->GetParallelProjection())
+        {
+          const double depth = (center[0] - position[0]) * direction[0] +
+            (center[1] - position[1]) * direction[1] + (center[2] - position[2]) * direction[2];
+
+          // Never cull a prop surrounding the camera
+          halfExtent = depth > radius ? depth * tanHalfAngle : 0.0;
+        }
+        culled = halfExtent > 0.0 && radius / halfExtent * height < this->MinimumInteractionSize;
+      }
+    }
+
+    if (culled)
+    {
+      prop->SetRenderTimeMultiplier(0.0);
+      pimpl.CulledProps.push_back(prop);
+      continue;
+    }
+
+    if (!initialized)
+    {
+      prop->SetRenderTimeMultiplier(1.0);
+    }
+    totalTime += prop->GetRenderTimeMultiplier();
+    propList[keptLength++] = prop;
+  }
+
+  // Drop the bounds of props not in the list anymore, which may have been deleted
+  for (auto it = pimpl.Cache.begin(); it != pimpl.Cache.end();)
+  {
+    it = it->second.CullIndex != pimpl.CullIndex ? pimpl.Cache.erase(it) : std::next(it);
+  }
+
+  std::copy(pimpl.CulledProps.begin(), pimpl.CulledProps.end(), propList + keptLength);
+  this->NumberOfCulledProps = static_cast<int>(pimpl.CulledProps.size());
+  listLength = keptLength;
+  initialized = 1;
+  return totalTime;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DFrustumCuller::ClearCache()
+{
+  this->Pimpl->Cache.clear();
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DFrustumCuller::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "MinimumInteractionSize: " << this->MinimumInteractionSize << "\n";
+  os << indent << "NumberOfCulledProps: " << this->NumberOfCulledProps << "\n";
+}
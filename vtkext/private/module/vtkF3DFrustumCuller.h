@@ -0,0 +1,71 @@
+/**
+ * @class   vtkF3DFrustumCuller
+ * @brief   Cull props outside of the view frustum or too small on screen
+ *
+ * Remove from the list of rendered props the actors and volumes whose bounds are entirely
+ * outside of the view frustum, so they never reach their mapper.
+ * The world bounds of the props are cached and only recomputed when the prop, its mapper or the
+ * pipeline upstream of its mapper is modified, which avoids updating the pipeline of each mapper
+ * every frame. Cached bounds of props that are not in the list of a call to Cull are dropped.
+ * Optionally, props smaller than a minimum size on screen are also culled while interacting.
+ * Props that are not used to compute the bounds, eg: the grid, and point gaussian actors,
+ * whose splats extend beyond their bounds, are never culled.
+ * Hidden props, eg: the coloring and point sprites actors not in use, are not even considered as
+ * the renderer only provides visible props to cullers.
+ */
+#ifndef vtkF3DFrustumCuller_h
+#define vtkF3DFrustumCuller_h
+
+#include <vtkCuller.h>
+
+#include <memory>
+
+class vtkF3DFrustumCuller : public vtkCuller
+{
+public:
+  static vtkF3DFrustumCuller* New();
+  vtkTypeMacro(vtkF3DFrustumCuller, vtkCuller);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Move the culled props at the end of the list and reduce its length accordingly.
+   * The order of the props that are not culled is preserved.
+   */
+  double Cull(vtkRenderer* ren, vtkProp** propList, int& listLength, int& initialized) override;
+
+  ///@{
+  /**
+   * Set/Get the minimum size in pixels on screen of the props rendered while interacting,
+   * computed using their bounding sphere. 0 means no props are culled because of their size.
+   * 0 by default
+   */
+  vtkSetClampMacro(MinimumInteractionSize, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(MinimumInteractionSize, double);
+  ///@}
+
+  /**
+   * Get the number of props culled by the last call to Cull
+   */
+  vtkGetMacro(NumberOfCulledProps, int);
+
+  /**
+   * Clear the cached bounds, to be called when props are removed
+   */
+  void ClearCache();
+
+protected:
+  vtkF3DFrustumCuller();
+  ~vtkF3DFrustumCuller() override;
+
+  double MinimumInteractionSize = 0.0;
+  int NumberOfCulledProps = 0;
+
+private:
+  vtkF3DFrustumCuller(const vtkF3DFrustumCuller&) = delete;
+  void operator=(const vtkF3DFrustumCuller&) = delete;
+
+  struct Internals;
+  std::unique_ptr<Internals> Pimpl;
+};
+
+#endif
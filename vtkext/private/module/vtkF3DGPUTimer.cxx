@@ -0,0 +1,261 @@
+#include "vtkF3DGPUTimer.h"
+
+#include "vtkF3DRenderer.h"
+
+#include <vtkObjectFactory.h>
+#include <vtk_glad.h>
+
+#include <algorithm>
+#include <array>
+
+struct vtkF3DGPUTimer::Internals
+{
+  // Number of frames that can be pending, results are usually available after 2 or 3 frames
+  static constexpr std::size_t RING_SIZE = 4;
+
+  struct Section
+  {
+    std::string Name;
+    std::size_t StartQuery;
+    std::size_t StopQuery;
+    bool Stopped = false;
+  };
+
+  struct Frame
+  {
+    // Queries are reused from one frame to another
+    std::vector<GLuint> Queries;
+    std::size_t NumberOfUsedQueries = 0;
+
+    // The first section is the whole frame
+    std::vector<Section> Sections;
+    bool Pending = false;
+
+    /**
+     * Record a timestamp in the next query and return its index
+     */
+    std::size_t RecordTimestamp()
+    {
+      if (this->NumberOfUsedQueries == this->Queries.size())
+      {
+        GLuint query = 0;
+#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+        glGenQueries(1, &query);
+#endif
+        this->Queries.push_back(query);
+      }
+#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+      glQueryCounter(this->Queries[this->NumberOfUsedQueries], GL_TIMESTAMP);
+#endif
+      return this->NumberOfUsedQueries++;
+    }
+
+    /**
+     * Return true if the results of all the queries are available, without waiting for them
+     */
+    bool IsAvailable() const
+    {
+#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+      for (std::size_t i = 0; i < this->NumberOfUsedQueries; i++)
+      {
+        GLint available = 0;
+        glGetQueryObjectiv(this->Queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available)
+        {
+          return false;
+        }
+      }
+      return true;
+#else
+      return false;
+#endif
+    }
+
+    /**
+     * Compute the timings of the sections in seconds, accumulating sections with the same name
+     */
+    void ComputeTimings(std::vector<std::pair<std::string, double>>& timings) const
+    {
+      timings.clear();
+#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+      std::vector<GLuint64> timestamps(this->NumberOfUsedQueries);
+      for (std::size_t i = 0; i < this->NumberOfUsedQueries; i++)
+      {
+        glGetQueryObjectui64v(this->Queries[i], GL_QUERY_RESULT, &timestamps[i]);
+      }
+
+      for (const Section& section : this->Sections)
+      {
+        if (!section.Stopped)
+        {
+          continue;
+        }
+
+        const double elapsed =
+          (timestamps[section.StopQuery] - timestamps[section.StartQuery]) * 1e-9;
+        auto it = std::find_if(timings.begin(), timings.end(),
+          [&](const std::pair<std::string, double>& timing)
+          { return timing.first == section.Name; });
+        if (it != timings.end())
+        {
+          it->second += elapsed;
+        }
+        else
+        {
+          timings.emplace_back(section.Name, elapsed);
+        }
+      }
+#endif
+    }
+  };
+
+  std::array<Frame, RING_SIZE> Ring;
+  std::size_t CurrentFrame = 0;
+  bool Measuring = false;
+
+  std::vector<std::pair<std::string, double>> Timings;
+
+  /**
+   * Read back the results of the pending frames that are available, oldest first
+   */
+  void ReadBackAvailableFrames()
+  {
+    for (std::size_t i = 1; i <= RING_SIZE; i++)
+    {
+      Frame& frame = this->Ring[(this->CurrentFrame + i) % RING_SIZE];
+      if (frame.Pending && frame.IsAvailable())
+      {
+        frame.ComputeTimings(this->Timings);
+        frame.Pending = false;
+      }
+    }
+  }
+};
+
+vtkStandardNewMacro(vtkF3DGPUTimer);
+
+//----------------------------------------------------------------------------
+vtkF3DGPUTimer::vtkF3DGPUTimer()
+  : Pimpl(new Internals())
+{
+}
+
+//----------------------------------------------------------------------------
+vtkF3DGPUTimer::~vtkF3DGPUTimer() = default;
+
+//----------------------------------------------------------------------------
+void vtkF3DGPUTimer::StartFrame()
+{
+#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+  Internals& pimpl = *this->Pimpl;
+  pimpl.ReadBackAvailableFrames();
+
+  std::size_t next = (pimpl.CurrentFrame + 1) % Internals::RING_SIZE;
+  Internals::Frame& frame = pimpl.Ring[next];
+  if (frame.Pending)
+  {
+    // Skip this frame rather than waiting for the GPU
+    pimpl.Measuring = false;
+    return;
+  }
+
+  pimpl.CurrentFrame = next;
+  pimpl.Measuring = true;
+  frame.NumberOfUsedQueries = 0;
+  frame.Sections.clear();
+  frame.Sections.push_back({ vtkF3DGPUTimer::FRAME_NAME, frame.RecordTimestamp(), 0 });
+#endif
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DGPUTimer::StopFrame()
+{
+  Internals& pimpl = *this->Pimpl;
+  if (!pimpl.Measuring)
+  {
+    return;
+  }
+
+  Internals::Frame& frame = pimpl.Ring[pimpl.CurrentFrame];
+  frame.Sections.front().StopQuery = frame.RecordTimestamp();
+  frame.Sections.front().Stopped = true;
+  frame.Pending = true;
+  pimpl.Measuring = false;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DGPUTimer::StartSection(const std::string& name)
+{
+  Internals& pimpl = *this->Pimpl;
+  if (!pimpl.Measuring)
+  {
+    return;
+  }
+
+  Internals::Frame& frame = pimpl.Ring[pimpl.CurrentFrame];
+  frame.Sections.push_back({ name, frame.RecordTimestamp(), 0 });
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DGPUTimer::StopSection(const std::string& name)
+{
+  Internals& pimpl = *this->Pimpl;
+  if (!pimpl.Measuring)
+  {
+    return;
+  }
+
+  // Stop the innermost started section with this name
+  Internals::Frame& frame = pimpl.Ring[pimpl.CurrentFrame];
+  auto it = std::find_if(frame.Sections.rbegin(), frame.Sections.rend(),
+    [&](const Internals::Section& section) { return !section.Stopped && section.Name == name; });
+  if (it != frame.Sections.rend())
+  {
+    it->StopQuery = frame.RecordTimestamp();
+    it->Stopped = true;
+  }
+}
+
+//----------------------------------------------------------------------------
+const std::vector<std::pair<std::string, double>>& vtkF3DGPUTimer::GetTimings()
+{
+  return this->Pimpl->Timings;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DGPUTimer::ReleaseGraphicsResources()
+{
+  for (Internals::Frame& frame : this->Pimpl->Ring)
+  {
+#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+    if (!frame.Queries.empty())
+    {
+      glDeleteQueries(static_cast<GLsizei>(frame.Queries.size()), frame.Queries.data());
+    }
+#endif
+    frame = Internals::Frame();
+  }
+  this->Pimpl->Measuring = false;
+  this->Pimpl->Timings.clear();
+}
+
+//----------------------------------------------------------------------------
+vtkF3DGPUTimer::ScopedSection::ScopedSection(vtkRenderer* renderer, std::string name)
+  : Name(std::move(name))
+{
+  vtkF3DRenderer* ren = vtkF3DRenderer::SafeDownCast(renderer);
+  if (ren)
+  {
+    this->Timer = ren->GetGPUTimer();
+    this->Timer->StartSection(this->Name);
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkF3DGPUTimer::ScopedSection::~ScopedSection()
+{
+  if (this->Timer)
+  {
+    this->Timer->StopSection(this->Name);
+  }
+}
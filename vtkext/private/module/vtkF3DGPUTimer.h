@@ -0,0 +1,100 @@
+/**
+ * @class   vtkF3DGPUTimer
+ * @brief   Non-blocking GPU timer of a frame and of its render passes
+ *
+ * Measure the GPU time of a frame and of named sections of it, eg: render passes, using OpenGL
+ * timestamp queries. Results are read back a few frames later, once available, so measuring
+ * never waits for the GPU. If all the queries of the ring are still pending when a frame starts,
+ * this frame is not measured.
+ * Sections with the same name in a frame are accumulated and sections can be nested.
+ * Timestamp queries are not supported by OpenGL ES, so nothing is measured on Android and
+ * WebAssembly.
+ */
+#ifndef vtkF3DGPUTimer_h
+#define vtkF3DGPUTimer_h
+
+#include <vtkObject.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+class vtkRenderer;
+
+class vtkF3DGPUTimer : public vtkObject
+{
+public:
+  static vtkF3DGPUTimer* New();
+  vtkTypeMacro(vtkF3DGPUTimer, vtkObject);
+
+  /**
+   * Name of the timing of the whole frame
+   */
+  static constexpr const char* FRAME_NAME = "Frame";
+
+  /**
+   * Start measuring a frame, after reading back the results of previous frames if available.
+   * Sections are only measured between StartFrame and StopFrame.
+   * The OpenGL context must be current.
+   */
+  void StartFrame();
+
+  /**
+   * Stop measuring the current frame, its results will be available in a later frame.
+   */
+  void StopFrame();
+
+  ///@{
+  /**
+   * Start or stop measuring a section of the current frame.
+   * Do nothing if no frame is being measured.
+   */
+  void StartSection(const std::string& name);
+  void StopSection(const std::string& name);
+  ///@}
+
+  /**
+   * Get the timings in seconds of the last measured frame whose results are available.
+   * The first timing is the whole frame, named FRAME_NAME, followed by the sections in the
+   * order they were started. Empty if no results are available yet.
+   */
+  const std::vector<std::pair<std::string, double>>& GetTimings();
+
+  /**
+   * Release the OpenGL queries and discard pending results.
+   * The OpenGL context must be current.
+   */
+  void ReleaseGraphicsResources();
+
+  /**
+   * Measure a section for its lifetime using the timer of the renderer.
+   * Do nothing if the renderer is not a vtkF3DRenderer.
+   */
+  class ScopedSection
+  {
+  public:
+    ScopedSection(vtkRenderer* renderer, std::string name);
+    ~ScopedSection();
+
+    ScopedSection(const ScopedSection&) = delete;
+    ScopedSection& operator=(const ScopedSection&) = delete;
+
+  private:
+    vtkF3DGPUTimer* Timer = nullptr;
+    std::string Name;
+  };
+
+protected:
+  vtkF3DGPUTimer();
+  ~vtkF3DGPUTimer() override;
+
+private:
+  vtkF3DGPUTimer(const vtkF3DGPUTimer&) = delete;
+  void operator=(const vtkF3DGPUTimer&) = delete;
+
+  struct Internals;
+  std::unique_ptr<Internals> Pimpl;
+};
+
+#endif
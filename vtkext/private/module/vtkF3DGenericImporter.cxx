@@ -1,6 +1,7 @@
 #include "vtkF3DGenericImporter.h"
 
 #include "F3DLog.h"
+#include "F3DOnDemandArraysReader.h"
 #include "vtkF3DPostProcessFilter.h"
 
 #include <vtkActor.h>
@@ -19,11 +20,29 @@
 #include <vtkRenderer.h>
 #include <vtkSmartPointer.h>
 #include <vtkStreamingDemandDrivenPipeline.h>
+#include <vtkTimeStamp.h>
 #include <vtkVersion.h>
+#include <vtkXMLDataSetWriter.h>
+#include <vtkXMLGenericDataObjectReader.h>
+#include <vtkXMLMultiBlockDataWriter.h>
+#include <vtksys/SystemTools.hxx>
 
+#include <array>
 #include <cassert>
+#include <filesystem>
+#include <mutex>
+#include <random>
 #include <sstream>
 
+namespace fs = std::filesystem;
+
+namespace
+{
+// Readers that are not thread safe, eg: netCDF/HDF5 based readers, may share global state,
+// so only one of them is updated at a time, whatever the thread updating it
+std::recursive_mutex NonThreadSafeReadersMutex;
+}
+
 struct vtkF3DGenericImporter::Internals
 {
   // Data structure for each block in a composite dataset
@@ -38,8 +57,13 @@ struct vtkF3DGenericImporter::Internals
   };
 
   vtkSmartPointer<vtkAlgorithm> Reader = nullptr;
+  vtkSmartPointer<vtkDataObject> Output = nullptr;
   std::vector<BlockData> Blocks;
   std::string OutputDescription;
+  std::string CacheDirectory;
+  vtkTimeStamp CacheTime;
+  bool CacheWritten = false;
+  bool ThreadSafeReader = false;
 
   bool HasAnimation = false;
   bool AnimationEnabled = false;
@@ -53,6 +77,203 @@ struct vtkF3DGenericImporter::Internals
     vtkImageData* image = vtkImageData::SafeDownCast(bd.PostPro->GetOutput(2));
     bd.Image = image && image->GetNumberOfCells() > 0 ? image : nullptr;
   }
+
+  /**
+   * Update existing blocks with a new output of the reader with the same structure
+   */
+  void UpdateBlocks(vtkDataObject* output)
+  {
+    vtkCompositeDataSet* composite = vtkCompositeDataSet::SafeDownCast(output);
+    if (composite)
+    {
+      auto iter = vtkSmartPointer<vtkCompositeDataIterator>::Take(composite->NewIterator());
+      iter->SkipEmptyNodesOn();
+
+      size_t blockIdx = 0;
+      for (iter->InitTraversal(); !iter->IsDoneWithTraversal() && blockIdx < this->Blocks.size();
+           iter->GoToNextItem(), blockIdx++)
+      {
+        vtkDataSet* block = vtkDataSet::SafeDownCast(iter->GetCurrentDataObject());
+        if (block)
+        {
+          this->UpdateBlock(this->Blocks[blockIdx], block);
+        }
+      }
+    }
+    else if (!this->Blocks.empty())
+    {
+      vtkDataSet* dataset = vtkDataSet::SafeDownCast(output);
+      if (dataset)
+      {
+        this->UpdateBlock(this->Blocks[0], dataset);
+      }
+    }
+  }
+
+  /**
+   * Lock the mutex shared by the readers that are not thread safe, if the reader is not.
+   * The returned lock must be kept while the reader is updated.
+   */
+  std::unique_lock<std::recursive_mutex> LockReader() const
+  {
+    if (this->ThreadSafeReader)
+    {
+      return std::unique_lock<std::recursive_mutex>();
+    }
+    return std::unique_lock<std::recursive_mutex>(NonThreadSafeReadersMutex);
+  }
+
+  /**
+   * Recover the reader as an on demand arrays reader, if it reads its arrays on demand
+   */
+  F3DOnDemandArraysReader* GetOnDemandArraysReader() const
+  {
+    F3DOnDemandArraysReader* onDemandReader =
+      dynamic_cast<F3DOnDemandArraysReader*>(this->Reader.GetPointer());
+    return onDemandReader && onDemandReader->GetReadArraysOnDemand() ? onDemandReader : nullptr;
+  }
+
+  /**
+   * Read the cached output if any, return nullptr otherwise
+   */
+  vtkSmartPointer<vtkDataObject> ReadCache() const
+  {
+    // Composite outputs are written as .vtm, datasets with their own extension
+    constexpr std::array<const char*, 6> extensions = { "vtm", "vtp", "vtu", "vti", "vts",
+      "vtr" };
+    for (const char* ext : extensions)
+    {
+      std::string cacheFile = this->CacheDirectory + "/geometry." + ext;
+      if (vtksys::SystemTools::FileExists(cacheFile, true))
+      {
+        vtkNew<vtkXMLGenericDataObjectReader> cacheReader;
+        cacheReader->SetFileName(cacheFile.c_str());
+        if (cacheReader->GetExecutive()->Update() && cacheReader->GetOutputDataObject(0))
+        {
+          F3DLog::Print(F3DLog::Severity::Debug, "Read geometry cache file: " + cacheFile);
+          return cacheReader->GetOutputDataObject(0);
+        }
+        F3DLog::Print(
+          F3DLog::Severity::Warning, "Could not read geometry cache file: " + cacheFile);
+        return nullptr;
+      }
+    }
+    return nullptr;
+  }
+
+  /**
+   * Write the output in the cache directory, if its type is supported.
+   * The output is written in a temporary directory renamed once complete,
+   * so that concurrent readers never see a partially written cache.
+   * Return true if this call created the cache.
+   */
+  bool WriteCache(vtkDataObject* output) const
+  {
+    vtkSmartPointer<vtkXMLWriter> writer;
+    if (vtkMultiBlockDataSet::SafeDownCast(output))
+    {
+      writer = vtkSmartPointer<vtkXMLMultiBlockDataWriter>::New();
+    }
+    else if (vtkDataSet::SafeDownCast(output))
+    {
+      writer = vtkSmartPointer<vtkXMLDataSetWriter>::New();
+    }
+    else
+    {
+      F3DLog::Print(F3DLog::Severity::Debug,
+        std::string("Geometry cache does not support ") + output->GetClassName() +
+          " outputs, output is not cached");
+      return false;
+    }
+
+    // Unique per writer, including writers from other processes sharing the cache
+    std::random_device rd;
+    const unsigned int suffix = std::uniform_int_distribution<unsigned int>()(rd);
+    const std::string tmpDirectory = this->CacheDirectory + ".tmp" + std::to_string(suffix);
+    if (!vtksys::SystemTools::MakeDirectory(tmpDirectory))
+    {
+      F3DLog::Print(F3DLog::Severity::Warning,
+        "Could not create geometry cache directory: " + tmpDirectory);
+      return false;
+    }
+
+    // Raw appended data is the fastest to read back
+    const std::string fileName = std::string("/geometry.") + writer->GetDefaultFileExtension();
+    const std::string tmpFile = tmpDirectory + fileName;
+    writer->SetFileName(tmpFile.c_str());
+    writer->SetInputDataObject(output);
+    writer->SetDataModeToAppended();
+    writer->EncodeAppendedDataOff();
+    writer->SetCompressorTypeToNone();
+    if (!writer->Write())
+    {
+      F3DLog::Print(F3DLog::Severity::Warning, "Could not write geometry cache file: " + tmpFile);
+      vtksys::SystemTools::RemoveADirectory(tmpDirectory);
+      return false;
+    }
+
+    // Renaming fails if another writer already created the cache, keep its cache then
+    std::error_code ec;
+    fs::rename(tmpDirectory, this->CacheDirectory, ec);
+    if (ec)
+    {
+      vtksys::SystemTools::RemoveADirectory(tmpDirectory);
+      if (!vtksys::SystemTools::FileExists(this->CacheDirectory + fileName, true))
+      {
+        F3DLog::Print(F3DLog::Severity::Warning,
+          "Could not write geometry cache file: " + this->CacheDirectory + fileName);
+      }
+      return false;
+    }
+    F3DLog::Print(
+      F3DLog::Severity::Debug, "Wrote geometry cache file: " + this->CacheDirectory + fileName);
+    return true;
+  }
+
+  /**
+   * Update the reader, or read the cache when available, and store its output
+   */
+  bool UpdateOutput()
+  {
+    std::unique_lock<std::recursive_mutex> lock = this->LockReader();
+
+    // Outputs of readers reading arrays on demand depend on the selected array
+    if (!this->CacheDirectory.empty() && !this->GetOnDemandArraysReader())
+    {
+      // Temporal outputs depend on the time value and cannot be cached
+      this->Reader->UpdateInformation();
+      if (!this->Reader->GetOutputInformation(0)->Has(
+            vtkStreamingDemandDrivenPipeline::TIME_RANGE()))
+      {
+        // Output has already been recovered, eg: by a previous UpdateInternalReader call
+        if (this->Output && this->CacheTime > this->Reader->GetMTime())
+        {
+          return true;
+        }
+
+        this->Output = this->ReadCache();
+        if (this->Output)
+        {
+          this->CacheWritten = false;
+          this->CacheTime.Modified();
+          return true;
+        }
+
+        bool status = this->Reader->GetExecutive()->Update();
+        this->Output = this->Reader->GetOutputDataObject(0);
+        if (status && this->Output)
+        {
+          this->CacheWritten = this->WriteCache(this->Output);
+          this->CacheTime.Modified();
+        }
+        return status;
+      }
+    }
+
+    bool status = this->Reader->GetExecutive()->Update();
+    this->Output = this->Reader->GetOutputDataObject(0);
+    return status;
+  }
 };
 
 vtkStandardNewMacro(vtkF3DGenericImporter);
@@ -67,6 +288,7 @@ vtkF3DGenericImporter::vtkF3DGenericImporter()
 void vtkF3DGenericImporter::UpdateTemporalInformation()
 {
   assert(this->Pimpl->Reader);
+  std::unique_lock<std::recursive_mutex> lock = this->Pimpl->LockReader();
   this->Pimpl->HasAnimation = false;
   this->Pimpl->Reader->UpdateInformation();
   vtkInformation* readerInfo = this->Pimpl->Reader->GetOutputInformation(0);
@@ -174,9 +396,9 @@ void vtkF3DGenericImporter::ImportActors(vtkRenderer* ren)
   vtkNew<vtkEventForwarderCommand> progressForwarder;
   progressForwarder->SetTarget(this);
   this->Pimpl->Reader->AddObserver(vtkCommand::ProgressEvent, progressForwarder);
-  bool status = this->Pimpl->Reader->GetExecutive()->Update();
+  bool status = this->Pimpl->UpdateOutput();
 
-  vtkDataObject* output = this->Pimpl->Reader->GetOutputDataObject(0);
+  vtkDataObject* output = this->Pimpl->Output;
   if (!status || !output)
   {
     this->SetFailureStatus();
@@ -253,6 +475,62 @@ void vtkF3DGenericImporter::SetInternalReader(vtkAlgorithm* reader)
   }
 }
 
+//----------------------------------------------------------------------------
+vtkAlgorithm* vtkF3DGenericImporter::GetInternalReader()
+{
+  return this->Pimpl->Reader;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DGenericImporter::SetThreadSafeReader(bool threadSafe)
+{
+  this->Pimpl->ThreadSafeReader = threadSafe;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DGenericImporter::GetThreadSafeReader()
+{
+  return this->Pimpl->ThreadSafeReader;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DGenericImporter::UpdateInternalReader()
+{
+  assert(this->Pimpl->Reader);
+  return this->Pimpl->UpdateOutput();
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DGenericImporter::AbortInternalReader()
+{
+  assert(this->Pimpl->Reader);
+  this->Pimpl->Reader->SetAbortExecute(1);
+}
+
+//----------------------------------------------------------------------------
+unsigned long vtkF3DGenericImporter::GetOutputMemorySize()
+{
+  return this->Pimpl->Output ? this->Pimpl->Output->GetActualMemorySize() : 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DGenericImporter::SetCacheDirectory(const std::string& directory)
+{
+  this->Pimpl->CacheDirectory = directory;
+}
+
+//----------------------------------------------------------------------------
+std::string vtkF3DGenericImporter::GetCacheDirectory()
+{
+  return this->Pimpl->CacheDirectory;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DGenericImporter::GetCacheWritten()
+{
+  return this->Pimpl->CacheWritten;
+}
+
 //----------------------------------------------------------------------------
 std::string vtkF3DGenericImporter::GetOutputsDescription()
 {
@@ -340,6 +618,7 @@ bool vtkF3DGenericImporter::UpdateAtTimeValue(double timeValue)
   }
 
   assert(this->Pimpl->Reader);
+  std::unique_lock<std::recursive_mutex> lock = this->Pimpl->LockReader();
 
   vtkInformation* info = this->Pimpl->Reader->GetOutputInformation(0);
   info->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(), timeValue);
@@ -352,34 +631,52 @@ bool vtkF3DGenericImporter::UpdateAtTimeValue(double timeValue)
     return false;
   }
 
-  vtkCompositeDataSet* composite = vtkCompositeDataSet::SafeDownCast(output);
+  this->Pimpl->UpdateBlocks(output);
+  this->UpdateOutputDescriptions();
+  return true;
+}
+
+//----------------------------------------------------------------------------
+std::vector<std::string> vtkF3DGenericImporter::GetOnDemandArrays(bool cellData)
+{
+  F3DOnDemandArraysReader* onDemandReader = this->Pimpl->GetOnDemandArraysReader();
+  return onDemandReader ? onDemandReader->GetAvailableArrays(cellData)
+                        : std::vector<std::string>();
+}
 
-  if (composite)
+//----------------------------------------------------------------------------
+bool vtkF3DGenericImporter::LoadArray(const std::string& name, bool cellData)
+{
+  F3DOnDemandArraysReader* onDemandReader = this->Pimpl->GetOnDemandArraysReader();
+  if (!onDemandReader || !onDemandReader->SelectArray(name, cellData))
   {
-    auto iter = vtkSmartPointer<vtkCompositeDataIterator>::Take(composite->NewIterator());
-    iter->SkipEmptyNodesOn();
+    return false;
+  }
 
-    size_t blockIdx = 0;
-    for (iter->InitTraversal();
-         !iter->IsDoneWithTraversal() && blockIdx < this->Pimpl->Blocks.size();
-         iter->GoToNextItem(), blockIdx++)
-    {
-      vtkDataSet* block = vtkDataSet::SafeDownCast(iter->GetCurrentDataObject());
-      if (block)
-      {
-        this->Pimpl->UpdateBlock(this->Pimpl->Blocks[blockIdx], block);
-      }
-    }
+  if (!this->UpdateImportedData())
+  {
+    F3DLog::Print(F3DLog::Severity::Warning, "A reader failed to read array: " + name);
+    return false;
   }
-  else if (!this->Pimpl->Blocks.empty())
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DGenericImporter::UpdateImportedData()
+{
+  assert(this->Pimpl->Reader);
+  std::unique_lock<std::recursive_mutex> lock = this->Pimpl->LockReader();
+
+  // The reader keeps the current time value, if any
+  bool status = this->Pimpl->Reader->GetExecutive()->Update();
+  vtkDataObject* output = this->Pimpl->Reader->GetOutputDataObject(0);
+  if (!status || !output)
   {
-    vtkDataSet* dataset = vtkDataSet::SafeDownCast(output);
-    if (dataset)
-    {
-      this->Pimpl->UpdateBlock(this->Pimpl->Blocks[0], dataset);
-    }
+    return false;
   }
 
+  this->Pimpl->Output = output;
+  this->Pimpl->UpdateBlocks(output);
   this->UpdateOutputDescriptions();
   return true;
 }
@@ -9,6 +9,8 @@
 #include "vtkF3DImporter.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 class vtkAlgorithm;
 class vtkDataObject;
@@ -29,6 +31,79 @@ public:
    */
   void SetInternalReader(vtkAlgorithm* reader);
 
+  /**
+   * Get the internal reader.
+   */
+  vtkAlgorithm* GetInternalReader();
+
+  ///@{
+  /**
+   * Set/Get if the internal reader can be updated concurrently with other readers.
+   * Readers relying on non thread safe libraries, eg: netCDF or HDF5, must not be set as such.
+   * Readers that are not thread safe are never updated at the same time, whatever the thread.
+   * Default is false.
+   */
+  void SetThreadSafeReader(bool threadSafe);
+  bool GetThreadSafeReader();
+  ///@}
+
+  /**
+   * Update the internal reader without creating any actor.
+   * This does not interact with any renderer so it can be called from a worker thread,
+   * concurrently with other readers only if the reader is thread safe,
+   * ImportActors will then reuse the already read output.
+   * Return false if the reader failed.
+   */
+  bool UpdateInternalReader();
+
+  /**
+   * Request the internal reader to abort its execution.
+   * Can be called from any thread, readers that check their abort flag will stop early.
+   */
+  void AbortInternalReader();
+
+  /**
+   * Get the actual memory size of the output of the internal reader, in kibibytes.
+   * Return 0 if the internal reader has not been updated yet.
+   */
+  unsigned long GetOutputMemorySize();
+
+  /**
+   * Set a directory used to cache the output of the internal reader.
+   * When a cached output exists in this directory, it is read instead of updating
+   * the internal reader, otherwise the output is written to it once read.
+   * Temporal outputs are never cached. Empty by default, which disables caching.
+   */
+  void SetCacheDirectory(const std::string& directory);
+  std::string GetCacheDirectory();
+
+  /**
+   * Return true if the last update of the internal reader wrote its output
+   * in the cache directory, false if it was read from the cache or not cached.
+   */
+  bool GetCacheWritten();
+
+  /**
+   * Get the names of the point or cell arrays that the internal reader can read on demand.
+   * Empty if the internal reader reads all its arrays, see F3DOnDemandArraysReader.
+   */
+  std::vector<std::string> GetOnDemandArrays(bool cellData);
+
+  /**
+   * Read the provided point or cell array on demand, in addition to the previously read ones,
+   * and update the imported data accordingly.
+   * Return true if the imported data changed.
+   */
+  bool LoadArray(const std::string& name, bool cellData);
+
+  /**
+   * Update the internal reader after it has been modified, eg: with new data,
+   * and update the imported data in place, keeping the existing actors and mappers.
+   * The output of the internal reader must keep the same structure.
+   * Return false if the internal reader failed to update.
+   */
+  bool UpdateImportedData();
+
   /**
    * Get a string describing the outputs
    */
@@ -1,5 +1,7 @@
 #include "vtkF3DHexagonalBokehBlurPass.h"
 
+#include "vtkF3DGPUTimer.h"
+
 #include "vtkObjectFactory.h"
 #include "vtkOpenGLError.h"
 #include "vtkOpenGLFramebufferObject.h"
@@ -307,6 +309,8 @@ void vtkF3DHexagonalBokehBlurPass::Render(const vtkRenderState* s)
 
   this->RenderDelegate(s, w, h);
 
+  vtkF3DGPUTimer::ScopedSection timerSection(r, "Blur");
+
   ostate->vtkglDisable(GL_BLEND);
   ostate->vtkglDisable(GL_DEPTH_TEST);
 
@@ -0,0 +1,339 @@
+#include "vtkF3DIStreamResourceStream.h"
+
+#include "F3DLog.h"
+
+#include <vtkObjectFactory.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+struct vtkF3DIStreamResourceStream::Internals
+{
+  std::istream* Input = nullptr;
+
+  // Position of the beginning of the content in an input that can seek, -1 otherwise
+  std::streamoff InputBase = -1;
+
+  // Content read so far from an input that cannot seek, in memory until it is moved into
+  // a spill file once larger than the threshold, when a spill directory is set
+  std::vector<char> Memory;
+  std::string SpillDirectory;
+  vtkTypeInt64 SpillThreshold = 0;
+  fs::path SpillPath;
+  std::fstream Spill;
+  vtkTypeInt64 ContentSize = 0;
+  bool InputEnded = false;
+
+  vtkTypeInt64 Position = 0;
+
+  bool IsBuffering() const
+  {
+    return this->Input && this->InputBase < 0;
+  }
+
+  /**
+   * Release the buffered content and remove the spill file, if any
+   */
+  void ReleaseContent()
+  {
+    if (this->Spill.is_open())
+    {
+      this->Spill.close();
+    }
+    if (!this->SpillPath.empty())
+    {
+      std::error_code ec;
+      fs::remove(this->SpillPath, ec);
+      this->SpillPath.clear();
+    }
+    std::vector<char>().swap(this->Memory);
+    this->ContentSize = 0;
+  }
+
+  /**
+   * Create the spill file in the spill directory, with a name unique to this process,
+   * and move the content buffered in memory into it.
+   * Return false if the spill file cannot be created.
+   */
+  bool OpenSpill()
+  {
+    static std::atomic<unsigned int> counter{ 0 };
+
+    this->SpillPath = fs::path(this->SpillDirectory) /
+      ("f3d_stream_" +
+        std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + "_" +
+        std::to_string(counter++) + ".tmp");
+    this->Spill.open(this->SpillPath,
+      std::ios_base::in | std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    if (!this->Spill.is_open())
+    {
+      F3DLog::Print(F3DLog::Severity::Warning,
+        "Cannot create spill file " + this->SpillPath.string() +
+          ", the input stream is kept in memory");
+      this->SpillPath.clear();
+      return false;
+    }
+
+    this->Spill.write(this->Memory.data(), static_cast<std::streamsize>(this->Memory.size()));
+    std::vector<char>().swap(this->Memory);
+    return true;
+  }
+
+  /**
+   * Append read content to the buffered content
+   */
+  void StoreContent(const char* data, std::size_t size)
+  {
+    if (!this->Spill.is_open() && !this->SpillDirectory.empty() &&
+      this->ContentSize + static_cast<vtkTypeInt64>(size) > this->SpillThreshold)
+    {
+      if (!this->OpenSpill())
+      {
+        // Do not try again for each read
+        this->SpillDirectory.clear();
+      }
+    }
+
+    if (this->Spill.is_open())
+    {
+      this->Spill.seekp(this->ContentSize);
+      this->Spill.write(data, static_cast<std::streamsize>(size));
+    }
+    else
+    {
+      this->Memory.insert(this->Memory.end(), data, data + size);
+    }
+    this->ContentSize += static_cast<vtkTypeInt64>(size);
+  }
+
+  /**
+   * Read up to size bytes of buffered content at pos into data.
+   * Return the number of bytes read.
+   */
+  std::size_t ReadContent(vtkTypeInt64 pos, char* data, std::size_t size)
+  {
+    size = static_cast<std::size_t>(std::min<vtkTypeInt64>(size, this->ContentSize - pos));
+    if (this->Spill.is_open())
+    {
+      this->Spill.seekg(pos);
+      this->Spill.read(data, static_cast<std::streamsize>(size));
+      size = static_cast<std::size_t>(this->Spill.gcount());
+      this->Spill.clear();
+    }
+    else
+    {
+      std::copy_n(this->Memory.data() + pos, size, data);
+    }
+    return size;
+  }
+
+  /**
+   * Read up to size bytes from the input into data, buffering them.
+   * Return the number of bytes read.
+   */
+  std::size_t ReadInput(char* data, std::size_t size)
+  {
+    if (this->InputEnded || size == 0)
+    {
+      return 0;
+    }
+
+    this->Input->read(data, static_cast<std::streamsize>(size));
+    std::size_t read = static_cast<std::size_t>(this->Input->gcount());
+    if (read < size)
+    {
+      this->InputEnded = true;
+    }
+
+    if (read > 0)
+    {
+      this->StoreContent(data, read);
+    }
+    return read;
+  }
+
+  /**
+   * Read the input until the buffered content contains at least size bytes or the input ends
+   */
+  void BufferUpTo(vtkTypeInt64 size)
+  {
+    // Chunked to avoid allocating the whole difference at once
+    constexpr vtkTypeInt64 CHUNK_SIZE = 1 << 20;
+    std::vector<char> chunk;
+    while (!this->InputEnded && this->ContentSize < size)
+    {
+      std::size_t toRead = static_cast<std::size_t>(std::min(CHUNK_SIZE, size - this->ContentSize));
+      chunk.resize(toRead);
+      this->ReadInput(chunk.data(), toRead);
+    }
+  }
+};
+
+vtkStandardNewMacro(vtkF3DIStreamResourceStream);
+
+//----------------------------------------------------------------------------
+vtkF3DIStreamResourceStream::vtkF3DIStreamResourceStream()
+  : vtkResourceStream(true)
+  , Pimpl(new Internals())
+{
+}
+
+//----------------------------------------------------------------------------
+vtkF3DIStreamResourceStream::~vtkF3DIStreamResourceStream()
+{
+  this->Pimpl->ReleaseContent();
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DIStreamResourceStream::SetInput(std::istream* input)
+{
+  this->Pimpl->ReleaseContent();
+  this->Pimpl->Input = input;
+  this->Pimpl->InputEnded = false;
+  this->Pimpl->Position = 0;
+  this->Pimpl->InputBase = input ? static_cast<std::streamoff>(input->tellg()) : -1;
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DIStreamResourceStream::SetSpillDirectory(const std::string& directory)
+{
+  this->Pimpl->SpillDirectory = directory;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DIStreamResourceStream::SetSpillThreshold(vtkTypeInt64 bytes)
+{
+  this->Pimpl->SpillThreshold = bytes;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DIStreamResourceStream::IsBuffering()
+{
+  return this->Pimpl->IsBuffering();
+}
+
+//----------------------------------------------------------------------------
+std::size_t vtkF3DIStreamResourceStream::Read(void* buffer, std::size_t bytes)
+{
+  Internals& pimpl = *this->Pimpl;
+  if (!pimpl.Input)
+  {
+    return 0;
+  }
+
+  char* data = static_cast<char*>(buffer);
+  if (!pimpl.IsBuffering())
+  {
+    pimpl.Input->read(data, static_cast<std::streamsize>(bytes));
+    std::size_t read = static_cast<std::size_t>(pimpl.Input->gcount());
+
+    // Keep the input usable for seeking once its end has been reached
+    pimpl.Input->clear();
+    pimpl.Position += static_cast<vtkTypeInt64>(read);
+    return read;
+  }
+
+  // Content already read from the input is read back from the buffered content
+  std::size_t read = 0;
+  if (pimpl.Position < pimpl.ContentSize)
+  {
+    read = pimpl.ReadContent(pimpl.Position, data, bytes);
+    pimpl.Position += static_cast<vtkTypeInt64>(read);
+  }
+
+  // Remaining content is read directly from the input, which is never read ahead
+  if (read < bytes && pimpl.Position == pimpl.ContentSize)
+  {
+    std::size_t inputRead = pimpl.ReadInput(data + read, bytes - read);
+    pimpl.Position += static_cast<vtkTypeInt64>(inputRead);
+    read += inputRead;
+  }
+  return read;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DIStreamResourceStream::EndOfStream()
+{
+  Internals& pimpl = *this->Pimpl;
+  if (!pimpl.Input)
+  {
+    return true;
+  }
+
+  if (pimpl.IsBuffering() && pimpl.Position < pimpl.ContentSize)
+  {
+    return false;
+  }
+
+  if (!pimpl.IsBuffering() || !pimpl.InputEnded)
+  {
+    bool ended = pimpl.Input->peek() == std::istream::traits_type::eof();
+    if (pimpl.IsBuffering())
+    {
+      pimpl.InputEnded = ended;
+    }
+    else
+    {
+      pimpl.Input->clear();
+    }
+    return ended;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkF3DIStreamResourceStream::Seek(vtkTypeInt64 pos, SeekDirection dir)
+{
+  Internals& pimpl = *this->Pimpl;
+  if (!pimpl.Input)
+  {
+    return 0;
+  }
+
+  if (!pimpl.IsBuffering())
+  {
+    pimpl.Input->clear();
+    if (dir == SeekDirection::End)
+    {
+      pimpl.Input->seekg(0, std::ios_base::end);
+      pos += static_cast<vtkTypeInt64>(pimpl.Input->tellg()) - pimpl.InputBase;
+    }
+    else if (dir == SeekDirection::Current)
+    {
+      pos += pimpl.Position;
+    }
+    pimpl.Input->seekg(pimpl.InputBase + std::max<vtkTypeInt64>(pos, 0));
+    pimpl.Position = static_cast<vtkTypeInt64>(pimpl.Input->tellg()) - pimpl.InputBase;
+    return pimpl.Position;
+  }
+
+  if (dir == SeekDirection::End)
+  {
+    pimpl.BufferUpTo(std::numeric_limits<vtkTypeInt64>::max());
+    pos += pimpl.ContentSize;
+  }
+  else if (dir == SeekDirection::Current)
+  {
+    pos += pimpl.Position;
+  }
+
+  // Seeking forward reads the input up to the new position, which is clamped to the content
+  pimpl.BufferUpTo(pos);
+  pimpl.Position = std::clamp<vtkTypeInt64>(pos, 0, pimpl.ContentSize);
+  return pimpl.Position;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkF3DIStreamResourceStream::Tell()
+{
+  return this->Pimpl->Position;
+}
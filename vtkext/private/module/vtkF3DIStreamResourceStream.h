@@ -0,0 +1,76 @@
+/**
+ * @class   vtkF3DIStreamResourceStream
+ * @brief   vtkResourceStream reading a std::istream incrementally
+ *
+ * Provide the content of a std::istream to readers supporting streams, without reading it
+ * entirely beforehand, so that readers can start parsing as soon as data is available.
+ * Input streams that can seek, eg: a file, are used as is.
+ * Content read from input streams that cannot seek, eg: a pipe, is buffered so that seeking
+ * backward is served from that buffer. It is kept in memory, unless a spill directory is set,
+ * in which case it is moved into a spill file in that directory once larger than the spill
+ * threshold. Seeking forward reads the input stream up to the new position and seeking relative
+ * to the end reads it entirely.
+ * The input stream must stay valid as long as it has not been entirely read.
+ */
+#ifndef vtkF3DIStreamResourceStream_h
+#define vtkF3DIStreamResourceStream_h
+
+#include <vtkResourceStream.h>
+
+#include <istream>
+#include <memory>
+#include <string>
+
+class vtkF3DIStreamResourceStream : public vtkResourceStream
+{
+public:
+  static vtkF3DIStreamResourceStream* New();
+  vtkTypeMacro(vtkF3DIStreamResourceStream, vtkResourceStream);
+
+  /**
+   * Set the input stream to read, its current position being the beginning of this stream.
+   * Any previously buffered content is discarded and the spill file removed.
+   */
+  void SetInput(std::istream* input);
+
+  /**
+   * Set the directory in which the content of an input stream that cannot seek is spilled.
+   * Empty by default, which keeps the content in memory.
+   */
+  void SetSpillDirectory(const std::string& directory);
+
+  /**
+   * Set the size in bytes of the buffered content above which it is moved into a spill file,
+   * when a spill directory is set. 0 by default, which spills any content.
+   */
+  void SetSpillThreshold(vtkTypeInt64 bytes);
+
+  ///@{
+  /**
+   * Overridden from vtkResourceStream.
+   */
+  std::size_t Read(void* buffer, std::size_t bytes) override;
+  bool EndOfStream() override;
+  vtkTypeInt64 Seek(vtkTypeInt64 pos, SeekDirection dir) override;
+  vtkTypeInt64 Tell() override;
+  ///@}
+
+  /**
+   * Return true if the content read from the input stream is buffered,
+   * which is the case when the input stream cannot seek.
+   */
+  bool IsBuffering();
+
+protected:
+  vtkF3DIStreamResourceStream();
+  ~vtkF3DIStreamResourceStream() override;
+
+private:
+  vtkF3DIStreamResourceStream(const vtkF3DIStreamResourceStream&) = delete;
+  void operator=(const vtkF3DIStreamResourceStream&) = delete;
+
+  struct Internals;
+  std::unique_ptr<Internals> Pimpl;
+};
+
+#endif
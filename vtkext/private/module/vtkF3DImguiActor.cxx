@@ -32,6 +32,7 @@
 #endif
 
 #include <imgui.h>
+#include <iomanip>
 #include <numeric>
 #include <optional>
 #include <sstream>
@@ -813,8 +814,16 @@ void vtkF3DImguiActor::RenderFpsCounter()
 
   constexpr float margin = F3DStyle::GetDefaultMargin();
 
-  std::string fpsString = std::to_string(this->FpsValue);
-  fpsString += " fps";
+  std::stringstream fpsStream;
+  fpsStream << this->FpsValue << " fps";
+
+  // GPU timings breakdown, in milliseconds
+  fpsStream << std::fixed << std::setprecision(2);
+  for (const auto& [name, time] : this->RenderTimings)
+  {
+    fpsStream << "\n" << name << ": " << time * 1000.0 << " ms";
+  }
+  std::string fpsString = fpsStream.str();
 
   ImVec2 winSize = ImGui::CalcTextSize(fpsString.c_str());
   winSize.x += 2.f * ImGui::GetStyle().WindowPadding.x;
@@ -12,6 +12,8 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <iterator>
+#include <mutex>
 
 struct vtkF3DImguiConsole::Internals
 {
@@ -25,9 +27,13 @@ struct vtkF3DImguiConsole::Internals
   };
 
   std::vector<std::pair<LogType, std::string>> Logs;
+  // Logs displayed by any thread, moved to Logs by the rendering thread
+  std::vector<std::pair<LogType, std::string>> PendingLogs;
   std::array<char, 2048> CurrentInput = {};
   bool NewError = false;
   bool NewWarning = false;
+  bool PendingError = false;
+  bool PendingWarning = false;
   std::pair<size_t, size_t> Completions{ 0,
     0 }; // Index for start and length of completions in Logs
   std::function<std::vector<std::string>(const std::string& pattern)>
@@ -36,6 +42,19 @@ struct vtkF3DImguiConsole::Internals
   std::pair<std::string, int> LastInput; // Last input before navigating history
   int CommandHistoryIndexInv = -1;       // Current inverted index in command history navigation
 
+  /**
+   * Move the pending logs to the logs, must be called with the display mutex locked
+   */
+  void FlushPendingLogs()
+  {
+    std::move(this->PendingLogs.begin(), this->PendingLogs.end(), std::back_inserter(this->Logs));
+    this->PendingLogs.clear();
+    this->NewError = this->NewError || this->PendingError;
+    this->NewWarning = this->NewWarning || this->PendingWarning;
+    this->PendingError = false;
+    this->PendingWarning = false;
+  }
+
   /**
    * Clear completions from the logs
    */
@@ -218,22 +237,26 @@ vtkF3DImguiConsole::~vtkF3DImguiConsole() = default;
 //----------------------------------------------------------------------------
 void vtkF3DImguiConsole::DisplayText(const char* text)
 {
+  // Readers may log from worker threads while the console is drawn,
+  // so logs are queued and only added to the console by the rendering thread
+  std::lock_guard<std::recursive_mutex> lock(this->DisplayMutex);
+
   MessageTypes type = this->GetCurrentMessageType();
   if (this->GetDisplayStream(type) != StreamType::Null)
   {
     switch (type)
     {
       case vtkOutputWindow::MESSAGE_TYPE_ERROR:
-        this->Pimpl->Logs.emplace_back(std::make_pair(Internals::LogType::Error, text));
-        this->Pimpl->NewError = true;
+        this->Pimpl->PendingLogs.emplace_back(std::make_pair(Internals::LogType::Error, text));
+        this->Pimpl->PendingError = true;
         break;
       case vtkOutputWindow::MESSAGE_TYPE_WARNING:
       case vtkOutputWindow::MESSAGE_TYPE_GENERIC_WARNING:
-        this->Pimpl->Logs.emplace_back(std::make_pair(Internals::LogType::Warning, text));
-        this->Pimpl->NewWarning = true;
+        this->Pimpl->PendingLogs.emplace_back(std::make_pair(Internals::LogType::Warning, text));
+        this->Pimpl->PendingWarning = true;
         break;
       default:
-        this->Pimpl->Logs.emplace_back(std::make_pair(Internals::LogType::Log, text));
+        this->Pimpl->PendingLogs.emplace_back(std::make_pair(Internals::LogType::Log, text));
     }
   }
 
@@ -244,6 +267,11 @@ void vtkF3DImguiConsole::DisplayText(const char* text)
 //----------------------------------------------------------------------------
 void vtkF3DImguiConsole::ShowConsole(bool minimal)
 {
+  {
+    std::lock_guard<std::recursive_mutex> lock(this->DisplayMutex);
+    this->Pimpl->FlushPendingLogs();
+  }
+
   const ImGuiViewport* viewport = ImGui::GetMainViewport();
 
   constexpr float margin = F3DStyle::GetDefaultMargin();
@@ -402,6 +430,11 @@ void vtkF3DImguiConsole::ShowConsole(bool minimal)
 //----------------------------------------------------------------------------
 void vtkF3DImguiConsole::ShowBadge()
 {
+  {
+    std::lock_guard<std::recursive_mutex> lock(this->DisplayMutex);
+    this->Pimpl->FlushPendingLogs();
+  }
+
   const ImGuiViewport* viewport = ImGui::GetMainViewport();
 
   if (this->Pimpl->NewError || this->Pimpl->NewWarning)
@@ -449,6 +482,10 @@ ImVec2 vtkF3DImguiConsole::GetBadgeSize()
 //----------------------------------------------------------------------------
 void vtkF3DImguiConsole::Clear()
 {
+  std::lock_guard<std::recursive_mutex> lock(this->DisplayMutex);
+  this->Pimpl->PendingLogs.clear();
+  this->Pimpl->PendingError = false;
+  this->Pimpl->PendingWarning = false;
   this->Pimpl->Logs.clear();
   this->Pimpl->NewError = false;
   this->Pimpl->NewWarning = false;
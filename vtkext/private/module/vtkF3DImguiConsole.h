@@ -8,6 +8,8 @@
  * It is also adding an input widget where commands registered in libf3d can be executed.
  * Finally, a small icon is displayed on the top right corner when the console is hidden but a new
  * warning or error is logged.
+ * Logs can be displayed by any thread, they are queued and only added to the console window
+ * and taken into account by the badge the next time ShowConsole or ShowBadge is called.
  */
 
 #ifndef vtkF3DImguiConsole_h
@@ -31,7 +33,7 @@ public:
   vtkTypeMacro(vtkF3DImguiConsole, vtkF3DConsoleOutputWindow);
 
   /**
-   * Add text to console
+   * Add text to console, deferred until the console or the badge is drawn next
    */
   void DisplayText(const char*) override;
 
@@ -1,14 +1,18 @@
 #include "vtkF3DMemoryMesh.h"
 
-#include "vtkDataArrayRange.h"
+#include "vtkCellArray.h"
 #include "vtkFloatArray.h"
-#include "vtkIdTypeArray.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkSMPTools.h"
+#include "vtkTypeInt32Array.h"
+#include "vtkTypeInt64Array.h"
 
-#include <numeric>
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 vtkStandardNewMacro(vtkF3DMemoryMesh);
 
@@ -34,6 +38,178 @@ vtkSmartPointer<vtkFloatArray> ConvertToFloatArray(const std::vector<float>& pos
 
   return arr;
 }
+
+//------------------------------------------------------------------------------
+/**
+ * Owners of the user memory wrapped into VTK arrays, indexed by the wrapped pointer.
+ * Owners of a pointer are released once all the buffers wrapping it have been freed,
+ * whatever the number of arrays sharing a buffer, eg: after a ShallowCopy.
+ */
+struct WrappedMemoryRegistry
+{
+  struct WrappedMemory
+  {
+    int NbBuffers = 0;
+    std::vector<std::shared_ptr<void>> Owners;
+  };
+
+  std::mutex Mutex;
+  std::unordered_map<const void*, WrappedMemory> Memories;
+
+  static WrappedMemoryRegistry& GetInstance()
+  {
+    // Never destroyed, as arrays may be freed during static destruction
+    static WrappedMemoryRegistry* registry = new WrappedMemoryRegistry();
+    return *registry;
+  }
+};
+
+//------------------------------------------------------------------------------
+void ReleaseWrappedMemory(void* data)
+{
+  WrappedMemoryRegistry& registry = WrappedMemoryRegistry::GetInstance();
+  std::vector<std::shared_ptr<void>> owners;
+  {
+    std::lock_guard<std::mutex> lock(registry.Mutex);
+    auto it = registry.Memories.find(data);
+    if (it == registry.Memories.end() || --it->second.NbBuffers > 0)
+    {
+      return;
+    }
+    owners = std::move(it->second.Owners);
+    registry.Memories.erase(it);
+  }
+  // Owners are released out of the lock, as their release may wrap memory again
+}
+
+//------------------------------------------------------------------------------
+template<typename ArrayType, typename ValueType>
+void WrapMemory(
+  ArrayType* arr, const ValueType* data, vtkIdType size, const std::shared_ptr<void>& owner)
+{
+  WrappedMemoryRegistry& registry = WrappedMemoryRegistry::GetInstance();
+  {
+    std::lock_guard<std::mutex> lock(registry.Mutex);
+    WrappedMemoryRegistry::WrappedMemory& memory = registry.Memories[data];
+    memory.NbBuffers++;
+    memory.Owners.emplace_back(owner);
+  }
+
+  // The data is not modified, the free function is called by the buffer once no array uses it
+  // anymore and only releases the owner
+  arr->SetArray(const_cast<ValueType*>(data), size, 0, VTK_DATA_ARRAY_USER_DEFINED);
+  arr->SetArrayFreeFunction(&::ReleaseWrappedMemory);
+}
+
+//------------------------------------------------------------------------------
+template<vtkIdType NbComponents>
+vtkSmartPointer<vtkFloatArray> WrapInFloatArray(
+  const float* data, vtkIdType size, const std::shared_ptr<void>& owner)
+{
+  vtkNew<vtkFloatArray> arr;
+  arr->SetNumberOfComponents(NbComponents);
+
+  if (size > 0)
+  {
+    ::WrapMemory(arr.Get(), data, size, owner);
+  }
+
+  return arr;
+}
+
+//------------------------------------------------------------------------------
+bool FitsInInt32(const unsigned int* faceIndices, vtkIdType size)
+{
+  return size <= VTK_TYPE_INT32_MAX &&
+    std::all_of(faceIndices, faceIndices + size,
+      [](unsigned int idx) { return idx <= static_cast<unsigned int>(VTK_TYPE_INT32_MAX); });
+}
+
+//------------------------------------------------------------------------------
+template<typename ArrayType>
+vtkSmartPointer<ArrayType> CreateOffsets(const unsigned int* faceSizes, vtkIdType nbFaces)
+{
+  using ValueType = typename ArrayType::ValueType;
+
+  vtkNew<ArrayType> offsets;
+  offsets->SetNumberOfTuples(nbFaces + 1);
+  ValueType* out = offsets->GetPointer(0);
+  out[0] = 0;
+
+  if (nbFaces > 0 &&
+    std::all_of(faceSizes, faceSizes + nbFaces,
+      [&](unsigned int faceSize) { return faceSize == faceSizes[0]; }))
+  {
+    // all faces have the same size (triangles, quads...), offsets can be filled independently
+    const ValueType faceSize = static_cast<ValueType>(faceSizes[0]);
+    vtkSMPTools::For(1, nbFaces + 1,
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType i = begin; i < end; i++)
+        {
+          out[i] = static_cast<ValueType>(i) * faceSize;
+        }
+      });
+  }
+  else
+  {
+    ValueType offset = 0;
+    for (vtkIdType i = 0; i < nbFaces; i++)
+    {
+      offset += static_cast<ValueType>(faceSizes[i]);
+      out[i + 1] = offset;
+    }
+  }
+
+  return offsets;
+}
+
+//------------------------------------------------------------------------------
+template<typename ArrayType>
+vtkSmartPointer<ArrayType> CopyConnectivity(const unsigned int* faceIndices, vtkIdType size)
+{
+  using ValueType = typename ArrayType::ValueType;
+
+  vtkNew<ArrayType> connectivity;
+  connectivity->SetNumberOfTuples(size);
+  ValueType* out = connectivity->GetPointer(0);
+
+  vtkSMPTools::For(0, size,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType i = begin; i < end; i++)
+      {
+        out[i] = static_cast<ValueType>(faceIndices[i]);
+      }
+    });
+
+  return connectivity;
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkCellArray> CopyFaces(
+  const unsigned int* faceSizes, vtkIdType nbFaces, const unsigned int* faceIndices, vtkIdType size)
+{
+  // 32 bits storage is used when possible as it halves the memory footprint and upload size
+  vtkNew<vtkCellArray> polys;
+  if (::FitsInInt32(faceIndices, size))
+  {
+    vtkSmartPointer<vtkTypeInt32Array> offsets =
+      ::CreateOffsets<vtkTypeInt32Array>(faceSizes, nbFaces);
+    vtkSmartPointer<vtkTypeInt32Array> connectivity =
+      ::CopyConnectivity<vtkTypeInt32Array>(faceIndices, size);
+    polys->SetData(offsets, connectivity);
+  }
+  else
+  {
+    vtkSmartPointer<vtkTypeInt64Array> offsets =
+      ::CreateOffsets<vtkTypeInt64Array>(faceSizes, nbFaces);
+    vtkSmartPointer<vtkTypeInt64Array> connectivity =
+      ::CopyConnectivity<vtkTypeInt64Array>(faceIndices, size);
+    polys->SetData(offsets, connectivity);
+  }
+  return polys;
+}
 }
 
 //------------------------------------------------------------------------------
@@ -53,51 +229,90 @@ void vtkF3DMemoryMesh::SetPoints(const std::vector<float>& positions)
   points->SetData(ConvertToFloatArray<3>(positions));
 
   this->Mesh->SetPoints(points);
+  this->Modified();
 }
 
 //------------------------------------------------------------------------------
 void vtkF3DMemoryMesh::SetNormals(const std::vector<float>& normals)
 {
   this->Mesh->GetPointData()->SetNormals(ConvertToFloatArray<3>(normals));
+  this->Modified();
 }
 
 //------------------------------------------------------------------------------
 void vtkF3DMemoryMesh::SetTCoords(const std::vector<float>& tcoords)
 {
   this->Mesh->GetPointData()->SetTCoords(ConvertToFloatArray<2>(tcoords));
+  this->Modified();
 }
 
 //------------------------------------------------------------------------------
 void vtkF3DMemoryMesh::SetFaces(
   const std::vector<unsigned int>& faceSizes, const std::vector<unsigned int>& faceIndices)
 {
-  vtkNew<vtkIdTypeArray> offsets;
-  vtkNew<vtkIdTypeArray> connectivity;
-  offsets->SetNumberOfTuples(faceSizes.size() + 1);
-  connectivity->SetNumberOfTuples(faceIndices.size());
+  this->Mesh->SetPolys(::CopyFaces(faceSizes.data(), static_cast<vtkIdType>(faceSizes.size()),
+    faceIndices.data(), static_cast<vtkIdType>(faceIndices.size())));
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkF3DMemoryMesh::SetPoints(
+  const float* positions, vtkIdType size, const std::shared_ptr<void>& owner)
+{
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToFloat();
+  points->SetData(::WrapInFloatArray<3>(positions, size, owner));
+
+  this->Mesh->SetPoints(points);
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkF3DMemoryMesh::SetNormals(
+  const float* normals, vtkIdType size, const std::shared_ptr<void>& owner)
+{
+  this->Mesh->GetPointData()->SetNormals(::WrapInFloatArray<3>(normals, size, owner));
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkF3DMemoryMesh::SetTCoords(
+  const float* tcoords, vtkIdType size, const std::shared_ptr<void>& owner)
+{
+  this->Mesh->GetPointData()->SetTCoords(::WrapInFloatArray<2>(tcoords, size, owner));
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkF3DMemoryMesh::SetFaces(const unsigned int* faceSizes, vtkIdType nbFaces,
+  const unsigned int* faceIndices, vtkIdType size, const std::shared_ptr<void>& owner)
+{
+  static_assert(sizeof(unsigned int) == sizeof(vtkTypeInt32));
 
-  // fill offsets
-  offsets->SetTypedComponent(0, 0, 0);
-  for (size_t i = 0; i < faceSizes.size(); i++)
+  if (size == 0 || !::FitsInInt32(faceIndices, size))
   {
-    offsets->SetTypedComponent(
-      i + 1, 0, offsets->GetTypedComponent(i, 0) + static_cast<vtkIdType>(faceSizes[i]));
+    this->Mesh->SetPolys(::CopyFaces(faceSizes, nbFaces, faceIndices, size));
+    this->Modified();
+    return;
   }
 
-  // fill connectivity
-  vtkSMPTools::For(0, faceIndices.size(),
-    [&](vtkIdType begin, vtkIdType end)
-    {
-      for (vtkIdType i = begin; i < end; i++)
-      {
-        connectivity->SetTypedComponent(i, 0, static_cast<vtkIdType>(faceIndices[i]));
-      }
-    });
+  // Signed and unsigned integers of the same size can alias each other
+  vtkNew<vtkTypeInt32Array> connectivity;
+  ::WrapMemory(connectivity.Get(), reinterpret_cast<const vtkTypeInt32*>(faceIndices), size, owner);
+
+  vtkSmartPointer<vtkTypeInt32Array> offsets =
+    ::CreateOffsets<vtkTypeInt32Array>(faceSizes, nbFaces);
 
   vtkNew<vtkCellArray> polys;
   polys->SetData(offsets, connectivity);
-
   this->Mesh->SetPolys(polys);
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkF3DMemoryMesh::GetNumberOfPoints()
+{
+  return this->Mesh->GetNumberOfPoints();
 }
 
 //------------------------------------------------------------------------------
@@ -4,13 +4,16 @@
  *
  * Simple source which convert and copy vectors provided by the user
  * to internal structure of vtkPolyData.
- * Does not support point data (normals, tcoords...) nor cell data yet.
+ * Buffers owned by the user can also be wrapped without any copy, in which case
+ * an owner object is kept alive as long as the buffers are used by VTK arrays.
  */
 #ifndef vtkF3DMemoryMesh_h
 #define vtkF3DMemoryMesh_h
 
 #include "vtkPolyDataAlgorithm.h"
 
+#include <memory>
+
 class vtkF3DMemoryMesh : public vtkPolyDataAlgorithm
 {
 public:
@@ -53,6 +56,37 @@ public:
   void SetFaces(
     const std::vector<unsigned int>& faceSizes, const std::vector<unsigned int>& faceIndices);
 
+  ///@{
+  /**
+   * Set contiguous list of positions, normals or texture coordinates without copying them.
+   * Requirements are the same as the copying versions, size being the number of floats.
+   * The data is not modified and must stay valid as long as owner is alive.
+   * A reference to owner is kept until the last VTK array using the data, including arrays
+   * sharing its buffer, is deleted.
+   */
+  void SetPoints(const float* positions, vtkIdType size, const std::shared_ptr<void>& owner);
+  void SetNormals(const float* normals, vtkIdType size, const std::shared_ptr<void>& owner);
+  void SetTCoords(const float* tcoords, vtkIdType size, const std::shared_ptr<void>& owner);
+  ///@}
+
+  /**
+   * Set faces by vertex indices without copying faceIndices when possible.
+   * Requirements are the same as the copying version, nbFaces and size being the number of
+   * elements of faceSizes and faceIndices respectively.
+   * faceSizes is only used during the call, faceIndices is used as the connectivity
+   * of the faces when 32 bits indices are enough, otherwise it is copied.
+   * The data is not modified and must stay valid as long as owner is alive.
+   * A reference to owner is kept until the last VTK array using the data, including arrays
+   * sharing its buffer, is deleted.
+   */
+  void SetFaces(const unsigned int* faceSizes, vtkIdType nbFaces, const unsigned int* faceIndices,
+    vtkIdType size, const std::shared_ptr<void>& owner);
+
+  /**
+   * Get the number of points of the mesh, as set by SetPoints.
+   */
+  vtkIdType GetNumberOfPoints();
+
 protected:
   vtkF3DMemoryMesh();
   ~vtkF3DMemoryMesh() override;
@@ -7,19 +7,43 @@
 #include <vtkActorCollection.h>
 #include <vtkCallbackCommand.h>
 #include <vtkCamera.h>
+#include <vtkGlyph3DMapper.h>
 #include <vtkImageData.h>
 #include <vtkObjectFactory.h>
 #include <vtkPolyData.h>
 #include <vtkRenderWindow.h>
 #include <vtkRendererCollection.h>
+#include <vtkSMPTools.h>
 #include <vtkSmartPointer.h>
 #include <vtkVersion.h>
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <numeric>
 #include <vector>
 
+namespace
+{
+//----------------------------------------------------------------------------
+/**
+ * Get the bounds of the geometry of an actor, using the mapper bounds
+ * for actors not using a polydata mapper, eg. instanced glyphs
+ */
+void GetActorBounds(vtkActor* actor, double bounds[6])
+{
+  vtkPolyDataMapper* pdMapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
+  if (pdMapper)
+  {
+    pdMapper->GetInput()->GetBounds(bounds);
+  }
+  else
+  {
+    actor->GetMapper()->GetBounds(bounds);
+  }
+}
+}
+
 //----------------------------------------------------------------------------
 struct vtkF3DMetaImporter::Internals
 {
@@ -41,6 +65,33 @@ struct vtkF3DMetaImporter::Internals
 
   F3DColoringInfoHandler ColoringInfoHandler;
 
+  /**
+   * Update coloring and point sprites actors after their original actors data changed
+   */
+  void UpdateColoringAndPointSprites()
+  {
+    for (auto& cs : this->ColoringActorsAndMappers)
+    {
+      cs.Mapper->SetInputData(
+        vtkPolyDataMapper::SafeDownCast(cs.OriginalActor->GetMapper())->GetInput());
+
+      bool visi = cs.Actor->GetVisibility();
+      cs.Actor->vtkProp3D::ShallowCopy(cs.OriginalActor);
+      cs.Actor->SetVisibility(visi);
+    }
+    for (auto& pss : this->PointSpritesActorsAndMappers)
+    {
+      if (!vtkF3DGenericImporter::SafeDownCast(pss.Importer))
+      {
+        pss.Mapper->SetInputData(
+          vtkPolyDataMapper::SafeDownCast(pss.OriginalActor->GetMapper())->GetInput());
+        bool visi = pss.Actor->GetVisibility();
+        pss.Actor->vtkProp3D::ShallowCopy(pss.OriginalActor);
+        pss.Actor->SetVisibility(visi);
+      }
+    }
+  }
+
 #if VTK_VERSION_NUMBER < VTK_VERSION_CHECK(9, 3, 20240707)
   std::map<vtkImporter*, vtkSmartPointer<vtkActorCollection>> ActorsForImporterMap;
 #endif
@@ -82,7 +133,138 @@ void vtkF3DMetaImporter::AddImporter(const vtkSmartPointer<vtkImporter>& importe
   this->Pimpl->Importers.emplace_back(
     vtkF3DMetaImporter::Internals::ImporterPair{ importer, false });
   this->Modified();
+  this->AddProgressObserver(importer);
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DMetaImporter::ReplaceImporter(
+  vtkImporter* previous, const vtkSmartPointer<vtkImporter>& importer)
+{
+  auto it = std::find_if(this->Pimpl->Importers.begin(), this->Pimpl->Importers.end(),
+    [&](const auto& importerPair) { return importerPair.Importer == previous; });
+  if (it == this->Pimpl->Importers.end())
+  {
+    return false;
+  }
+
+  if (it->Updated)
+  {
+    this->RemoveImportedActors(previous);
+  }
+  previous->RemoveObservers(vtkCommand::ProgressEvent);
+
+  it->Importer = importer;
+  it->Updated = false;
+  this->Modified();
+  this->AddProgressObserver(importer);
+  return true;
+}
 
+//----------------------------------------------------------------------------
+bool vtkF3DMetaImporter::RemoveImporter(vtkImporter* importer)
+{
+  auto it = std::find_if(this->Pimpl->Importers.begin(), this->Pimpl->Importers.end(),
+    [&](const auto& importerPair) { return importerPair.Importer == importer; });
+  if (it == this->Pimpl->Importers.end())
+  {
+    return false;
+  }
+
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 3, 20240707)
+  // Imported actors are known even if the update of the importer failed
+  this->RemoveImportedActors(importer);
+#else
+  if (it->Updated)
+  {
+    this->RemoveImportedActors(importer);
+  }
+#endif
+  importer->RemoveObservers(vtkCommand::ProgressEvent);
+
+  this->Pimpl->Importers.erase(it);
+  this->Modified();
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DMetaImporter::RemoveImportedActors(vtkImporter* importer)
+{
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 3, 20240707)
+  vtkActorCollection* actorCollection = importer->GetImportedActors();
+#else
+  vtkSmartPointer<vtkActorCollection> actorCollection =
+    this->Pimpl->ActorsForImporterMap.at(importer);
+  this->Pimpl->ActorsForImporterMap.erase(importer);
+#endif
+
+  vtkCollectionSimpleIterator ait;
+  actorCollection->InitTraversal(ait);
+  while (auto* actor = actorCollection->GetNextActor(ait))
+  {
+    this->Renderer->RemoveActor(actor);
+    this->ActorCollection->RemoveItem(actor);
+
+    auto& coloringStructs = this->Pimpl->ColoringActorsAndMappers;
+    for (auto csIt = coloringStructs.begin(); csIt != coloringStructs.end();)
+    {
+      if (csIt->OriginalActor == actor)
+      {
+        this->Renderer->RemoveActor(csIt->Actor);
+        csIt = coloringStructs.erase(csIt);
+      }
+      else
+      {
+        ++csIt;
+      }
+    }
+  }
+
+  auto& pointSpritesStructs = this->Pimpl->PointSpritesActorsAndMappers;
+  for (auto pssIt = pointSpritesStructs.begin(); pssIt != pointSpritesStructs.end();)
+  {
+    if (pssIt->Importer == importer)
+    {
+      this->Renderer->RemoveActor(pssIt->Actor);
+      pssIt = pointSpritesStructs.erase(pssIt);
+    }
+    else
+    {
+      ++pssIt;
+    }
+  }
+
+  auto& volumeStructs = this->Pimpl->VolumePropsAndMappers;
+  for (auto vsIt = volumeStructs.begin(); vsIt != volumeStructs.end();)
+  {
+    if (vsIt->Importer == importer)
+    {
+      this->Renderer->RemoveVolume(vsIt->Prop);
+      vsIt = volumeStructs.erase(vsIt);
+    }
+    else
+    {
+      ++vsIt;
+    }
+  }
+
+  // Recompute the bounding box from the remaining actors
+  this->Pimpl->GeometryBoundingBox.Reset();
+  vtkCollectionSimpleIterator remainingIt;
+  this->ActorCollection->InitTraversal(remainingIt);
+  while (auto* actor = this->ActorCollection->GetNextActor(remainingIt))
+  {
+    double bounds[6];
+    ::GetActorBounds(actor, bounds);
+    this->Pimpl->GeometryBoundingBox.AddBounds(bounds);
+  }
+
+  // Coloring info is accumulated, it will be recomputed from scratch after next Update
+  this->Pimpl->ColoringInfoHandler.ClearColoringInfo();
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DMetaImporter::AddProgressObserver(vtkImporter* importer)
+{
   // Add a progress event observer
   vtkNew<vtkCallbackCommand> progressCallback;
   progressCallback->SetClientData(this);
@@ -154,6 +336,39 @@ bool vtkF3DMetaImporter::Update()
     localCameraIndex = this->Pimpl->CameraIndex.value();
   }
 
+  // Thread safe readers of generic importers only touch their own data, so read them
+  // concurrently first. Other readers, eg: netCDF/HDF5 based readers, are read one after
+  // the other in the loop below, where actors creation and renderer interactions are done
+  // sequentially in the original order. Progress is not forwarded during this step as it
+  // would render.
+  std::vector<vtkF3DGenericImporter*> pendingGenericImporters;
+  for (const auto& importerPair : this->Pimpl->Importers)
+  {
+    vtkF3DGenericImporter* genericImporter =
+      vtkF3DGenericImporter::SafeDownCast(importerPair.Importer);
+    if (!importerPair.Updated && genericImporter && genericImporter->GetThreadSafeReader())
+    {
+      pendingGenericImporters.emplace_back(genericImporter);
+    }
+  }
+  if (pendingGenericImporters.size() > 1)
+  {
+    // Readers parallelize their own work using vtkSMPTools, which would run serially when
+    // nested in this loop otherwise
+    const bool nestedParallelism = vtkSMPTools::GetNestedParallelism();
+    vtkSMPTools::SetNestedParallelism(true);
+    vtkSMPTools::For(0, static_cast<vtkIdType>(pendingGenericImporters.size()), 1,
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType i = begin; i < end; i++)
+        {
+          // Failures are reported when importing actors
+          pendingGenericImporters[i]->UpdateInternalReader();
+        }
+      });
+    vtkSMPTools::SetNestedParallelism(nestedParallelism);
+  }
+
   for (auto& importerPair : this->Pimpl->Importers)
   {
     vtkImporter* importer = importerPair.Importer;
@@ -238,14 +453,21 @@ bool vtkF3DMetaImporter::Update()
       // Add to the actor collection
       this->ActorCollection->AddItem(actor);
 
-      vtkPolyDataMapper* pdMapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
-      vtkPolyData* surface = pdMapper->GetInput();
-
       // Increase bounding box size if needed
       double bounds[6];
-      surface->GetBounds(bounds);
+      ::GetActorBounds(actor, bounds);
       this->Pimpl->GeometryBoundingBox.AddBounds(bounds);
 
+      vtkPolyDataMapper* pdMapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
+      if (!pdMapper)
+      {
+        // Instanced actors, eg. USD point instancers using a vtkGlyph3DMapper,
+        // do not support coloring nor point sprites
+        actorIndex++;
+        continue;
+      }
+      vtkPolyData* surface = pdMapper->GetInput();
+
       // Create and configure coloring actors
       this->Pimpl->ColoringActorsAndMappers.emplace_back(vtkF3DMetaImporter::ColoringStruct(actor));
       vtkF3DMetaImporter::ColoringStruct& cs = this->Pimpl->ColoringActorsAndMappers.back();
@@ -279,6 +501,7 @@ bool vtkF3DMetaImporter::Update()
           this->Pimpl->VolumePropsAndMappers.emplace_back(vtkF3DMetaImporter::VolumeStruct());
           vtkF3DMetaImporter::VolumeStruct& vs = this->Pimpl->VolumePropsAndMappers.back();
           vs.Mapper->SetInputData(image);
+          vs.Importer = importer;
           this->Renderer->AddVolume(vs.Prop);
           vs.Prop->VisibilityOff();
         }
@@ -570,30 +793,48 @@ bool vtkF3DMetaImporter::UpdateAtTimeValue(double timeValue)
 #endif
   }
 
-  // Update coloring and point sprites
-  for (auto& cs : this->Pimpl->ColoringActorsAndMappers)
-  {
-    cs.Mapper->SetInputData(
-      vtkPolyDataMapper::SafeDownCast(cs.OriginalActor->GetMapper())->GetInput());
+  this->Pimpl->UpdateColoringAndPointSprites();
+  this->Pimpl->UpdateTime.Modified();
+  return ret;
+}
 
-    bool visi = cs.Actor->GetVisibility();
-    cs.Actor->vtkProp3D::ShallowCopy(cs.OriginalActor);
-    cs.Actor->SetVisibility(visi);
-  }
-  for (auto& pss : this->Pimpl->PointSpritesActorsAndMappers)
+//----------------------------------------------------------------------------
+bool vtkF3DMetaImporter::LoadColoringArray(const std::string& name, bool useCellData)
+{
+  bool loaded = false;
+  for (const auto& importerPair : this->Pimpl->Importers)
   {
-    if (!vtkF3DGenericImporter::SafeDownCast(pss.Importer))
+    vtkF3DGenericImporter* genericImporter =
+      vtkF3DGenericImporter::SafeDownCast(importerPair.Importer);
+    if (importerPair.Updated && genericImporter)
     {
-      pss.Mapper->SetInputData(
-        vtkPolyDataMapper::SafeDownCast(pss.OriginalActor->GetMapper())->GetInput());
-      bool visi = pss.Actor->GetVisibility();
-      pss.Actor->vtkProp3D::ShallowCopy(pss.OriginalActor);
-      pss.Actor->SetVisibility(visi);
+      loaded = genericImporter->LoadArray(name, useCellData) || loaded;
     }
   }
 
+  if (loaded)
+  {
+    // Coloring info of the array is computed now that it has been read
+    this->Pimpl->UpdateColoringAndPointSprites();
+    this->Pimpl->UpdateTime.Modified();
+  }
+  return loaded;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DMetaImporter::UpdateImportedData(vtkF3DGenericImporter* importer)
+{
+  auto it = std::find_if(this->Pimpl->Importers.begin(), this->Pimpl->Importers.end(),
+    [&](const auto& importerPair) { return importerPair.Importer == importer; });
+  if (it == this->Pimpl->Importers.end() || !it->Updated || !importer->UpdateImportedData())
+  {
+    return false;
+  }
+
+  // Coloring info depends on the new data
+  this->Pimpl->UpdateColoringAndPointSprites();
   this->Pimpl->UpdateTime.Modified();
-  return ret;
+  return true;
 }
 
 //----------------------------------------------------------------------------
@@ -615,12 +856,26 @@ void vtkF3DMetaImporter::UpdateInfoForColoring()
         vtkF3DGenericImporter::SafeDownCast(importerPair.Importer);
       vtkIdType actorIndex = 0;
 
+      // Arrays read on demand can be used for coloring before being read
+      if (genericImporter)
+      {
+        this->Pimpl->ColoringInfoHandler.AddAvailableArrays(
+          genericImporter->GetOnDemandArrays(false), false);
+        this->Pimpl->ColoringInfoHandler.AddAvailableArrays(
+          genericImporter->GetOnDemandArrays(true), true);
+      }
+
       vtkCollectionSimpleIterator ait;
       actorCollection->InitTraversal(ait);
       while (auto* actor = actorCollection->GetNextActor(ait))
       {
         vtkPolyDataMapper* pdMapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
-        assert(pdMapper);
+        if (!pdMapper)
+        {
+          // Instanced actors do not support coloring
+          actorIndex++;
+          continue;
+        }
 
         // Update coloring vectors, with a dedicated logic for generic importer
         vtkDataSet* datasetForColoring = pdMapper->GetInput();
@@ -667,9 +922,21 @@ std::string vtkF3DMetaImporter::GetMetaDataDescription() const
   this->ActorCollection->InitTraversal(ait);
   while (auto* actor = this->ActorCollection->GetNextActor(ait))
   {
-    vtkPolyData* surface = vtkPolyDataMapper::SafeDownCast(actor->GetMapper())->GetInput();
-    nPoints += surface->GetNumberOfPoints();
-    nCells += surface->GetNumberOfCells();
+    vtkPolyDataMapper* pdMapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
+    vtkGlyph3DMapper* glyphMapper = vtkGlyph3DMapper::SafeDownCast(actor->GetMapper());
+    if (pdMapper)
+    {
+      vtkPolyData* surface = pdMapper->GetInput();
+      nPoints += surface->GetNumberOfPoints();
+      nCells += surface->GetNumberOfCells();
+    }
+    else if (glyphMapper && glyphMapper->GetSource() && glyphMapper->GetInput())
+    {
+      // Count each instance of the glyph
+      vtkIdType nInstances = glyphMapper->GetInput()->GetNumberOfPoints();
+      nPoints += glyphMapper->GetSource()->GetNumberOfPoints() * nInstances;
+      nCells += glyphMapper->GetSource()->GetNumberOfCells() * nInstances;
+    }
   }
 
   description += "Number of points: ";
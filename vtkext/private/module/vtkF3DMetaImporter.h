@@ -26,6 +26,8 @@
 #include <string>
 #include <vector>
 
+class vtkF3DGenericImporter;
+
 class vtkF3DMetaImporter : public vtkF3DImporter
 {
 public:
@@ -45,6 +47,7 @@ public:
     }
     vtkNew<vtkVolume> Prop;
     vtkNew<vtkSmartVolumeMapper> Mapper;
+    vtkImporter* Importer = nullptr;
   };
 
   struct PointSpritesStruct
@@ -93,6 +96,23 @@ public:
    */
   void AddImporter(const vtkSmartPointer<vtkImporter>& importer);
 
+  /**
+   * Replace a previously added importer by another one, keeping its position.
+   * Actors, point sprites and volumes created for the previous importer are removed from the
+   * renderer while the ones of other importers are kept as is.
+   * The new importer is imported on next Update.
+   * Return false if the previous importer was not found.
+   */
+  bool ReplaceImporter(vtkImporter* previous, const vtkSmartPointer<vtkImporter>& importer);
+
+  /**
+   * Remove a previously added importer, as well as the actors, point sprites and volumes
+   * created for it, including the ones of a failed Update.
+   * The importers of other files are kept as is.
+   * Return false if the importer was not found.
+   */
+  bool RemoveImporter(vtkImporter* importer);
+
   /**
    * Get the bounding box of all geometry actors
    * Should be called after actors have been imported
@@ -161,6 +181,20 @@ public:
    */
   bool UpdateAtTimeValue(double timeValue) override;
 
+  /**
+   * Read the provided array with importers reading their arrays on demand,
+   * see F3DOnDemandArraysReader.
+   * Return true if any imported data changed, coloring info is then updated accordingly.
+   */
+  bool LoadColoringArray(const std::string& name, bool useCellData);
+
+  /**
+   * Update the imported data of a generic importer whose internal reader has been modified,
+   * keeping its actors and mappers, see vtkF3DGenericImporter::UpdateImportedData.
+   * Return false if the importer has not been updated before or failed to update.
+   */
+  bool UpdateImportedData(vtkF3DGenericImporter* importer);
+
   /**
    * Get the update mTime
    */
@@ -185,6 +219,17 @@ private:
    */
   void UpdateInfoForColoring();
 
+  /**
+   * Forward progress of an individual importer as the progress of this importer
+   */
+  void AddProgressObserver(vtkImporter* importer);
+
+  /**
+   * Remove all actors, point sprites and volumes created for the provided importer
+   * and recompute the geometry bounding box
+   */
+  void RemoveImportedActors(vtkImporter* importer);
+
   struct Internals;
   std::unique_ptr<Internals> Pimpl;
 
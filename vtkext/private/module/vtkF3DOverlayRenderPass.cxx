@@ -1,5 +1,7 @@
 #include "vtkF3DOverlayRenderPass.h"
 
+#include "vtkF3DGPUTimer.h"
+
 #include <vtkCameraPass.h>
 #include <vtkDefaultPass.h>
 #include <vtkObjectFactory.h>
@@ -38,7 +40,10 @@ void vtkF3DOverlayRenderPass::Render(const vtkRenderState* s)
     this->OverlayProps.data(), static_cast<int>(this->OverlayProps.size()));
   overlayState.SetFrameBuffer(s->GetFrameBuffer());
 
-  this->OverlayPass->Render(&overlayState);
+  {
+    vtkF3DGPUTimer::ScopedSection timerSection(r, "Overlay");
+    this->OverlayPass->Render(&overlayState);
+  }
   r->SetBackground(bgColor);
 
   this->CompositeOverlay(s);
@@ -204,6 +209,8 @@ void vtkF3DOverlayRenderPass::CompositeOverlay(const vtkRenderState* s)
     renWin->GetShaderCache()->ReadyShaderProgram(this->QuadHelper->Program);
   }
 
+  vtkF3DGPUTimer::ScopedSection timerSection(r, "Overlay");
+
   this->OverlayPass->GetColorTexture()->Activate();
   this->ColorTexture->Activate();
 
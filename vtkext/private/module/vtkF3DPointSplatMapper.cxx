@@ -3,6 +3,7 @@
 #if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
 #include "vtkF3DBitonicSort.h"
 #include "vtkF3DComputeDepthCS.h"
+#include "vtkF3DGPUTimer.h"
 #endif
 #include "vtkF3DPointSplatVS.h"
 #include "vtkF3DRenderer.h"
@@ -334,6 +335,8 @@ void vtkF3DSplatMapperHelper::SortSplats(vtkRenderer* ren)
     // sort the splats only if the camera direction has changed
     if (vtkMath::Dot(this->LastDirection, direction) < this->DirectionThreshold)
     {
+      vtkF3DGPUTimer::ScopedSection timerSection(ren, "Splat sort");
+
       vtkOpenGLShaderCache* shaderCache =
         vtkOpenGLRenderWindow::SafeDownCast(ren->GetRenderWindow())->GetShaderCache();
 
@@ -1,5 +1,6 @@
 #include "vtkF3DRenderPass.h"
 
+#include "vtkF3DGPUTimer.h"
 #include "vtkF3DHexagonalBokehBlurPass.h"
 #include "vtkF3DImporter.h"
 #include "vtkF3DRenderer.h"
@@ -38,6 +39,44 @@
 #endif
 
 #include <sstream>
+#include <string>
+
+namespace
+{
+/**
+ * Pass measuring its delegate pass in a section of the renderer GPU timer
+ */
+class vtkF3DTimedPass : public vtkRenderPass
+{
+public:
+  static vtkF3DTimedPass* New();
+  vtkTypeMacro(vtkF3DTimedPass, vtkRenderPass);
+
+  void Render(const vtkRenderState* s) override
+  {
+    vtkF3DGPUTimer::ScopedSection timerSection(s->GetRenderer(), this->SectionName);
+    this->DelegatePass->Render(s);
+    this->NumberOfRenderedProps = this->DelegatePass->GetNumberOfRenderedProps();
+  }
+
+  void ReleaseGraphicsResources(vtkWindow* w) override
+  {
+    this->DelegatePass->ReleaseGraphicsResources(w);
+  }
+
+  vtkSmartPointer<vtkRenderPass> DelegatePass;
+  std::string SectionName;
+};
+vtkStandardNewMacro(vtkF3DTimedPass);
+
+vtkSmartPointer<vtkRenderPass> CreateTimedPass(vtkRenderPass* pass, const std::string& name)
+{
+  vtkNew<vtkF3DTimedPass> timedP;
+  timedP->DelegatePass = pass;
+  timedP->SectionName = name;
+  return timedP;
+}
+}
 
 vtkStandardNewMacro(vtkF3DRenderPass);
 
@@ -171,7 +210,8 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
         ssaoP->SetKernelSize(200);
         ssaoP->SetDelegatePass(ssaoCamP);
 
-        collection->AddItem(ssaoP);
+        // Includes the opaque geometry rendered by the SSAO pass
+        collection->AddItem(::CreateTimedPass(ssaoP, "SSAO"));
       }
       else
       {
@@ -190,7 +230,8 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
       vtkNew<vtkDualDepthPeelingPass> ddpP;
       ddpP->SetTranslucentPass(translucentP);
       ddpP->SetVolumetricPass(volumeP);
-      collection->AddItem(ddpP);
+      // Includes the translucent geometry rendered by the depth peeling pass
+      collection->AddItem(::CreateTimedPass(ddpP, "Depth peeling"));
     }
     else if (renderer && renderer->GetBlendingMode() == vtkF3DRenderer::BlendingMode::STOCHASTIC)
     {
@@ -2,7 +2,9 @@
 
 #include "F3DColoringInfoHandler.h"
 #include "F3DDefaultHDRI.h"
+#include "F3DFileHash.h"
 #include "F3DLog.h"
+#include "F3DTextureDecoder.h"
 #include "F3DUtils.h"
 #include "vtkF3DCachedLUTTexture.h"
 #include "vtkF3DCachedSpecularTexture.h"
@@ -72,8 +74,8 @@
 #include <vtkXMLMultiBlockDataWriter.h>
 #include <vtkXMLTableReader.h>
 #include <vtkXMLTableWriter.h>
+#include <vtkXMLWriter.h>
 #include <vtksys/FStream.hxx>
-#include <vtksys/MD5.h>
 #include <vtksys/SystemTools.hxx>
 
 #if F3D_MODULE_UI
@@ -102,8 +104,11 @@
 #include <vtk_glew.h>
 #endif
 
+#include <algorithm>
 #include <cctype>
 #include <chrono>
+#include <future>
+#include <random>
 #include <sstream>
 
 namespace
@@ -129,29 +134,55 @@ std::string DeprecatedCollapsePath(const fs::path& path)
 }
 
 //----------------------------------------------------------------------------
-// Compute the MD5 hash of an existing file on disk
-std::string ComputeFileHash(const std::string& filepath)
+// Write the input of a XML writer in a temporary directory moved in place once complete,
+// so that other threads and processes sharing the cache never read a partially written file.
+// Composite writers also write a data directory next to the file, it is moved first.
+bool WriteCacheFile(vtkXMLWriter* writer, const std::string& path)
 {
-  unsigned char digest[16];
-  char md5Hash[33];
-  md5Hash[32] = '\0';
+  const fs::path target(path);
+  std::random_device rd;
+  const std::string suffix = std::to_string(std::uniform_int_distribution<unsigned int>()(rd));
+  const fs::path tmpDirectory =
+    target.parent_path() / (target.filename().string() + ".tmp" + suffix);
+  const fs::path tmpFile = tmpDirectory / target.filename();
 
-  std::size_t length = vtksys::SystemTools::FileLength(filepath);
-  std::vector<char> buffer(length);
-
-  vtksys::ifstream file;
-  file.open(filepath.c_str(), std::ios_base::binary);
-  file.read(buffer.data(), length);
+  std::error_code ec;
+  bool success = fs::create_directories(tmpDirectory, ec);
+  if (success)
+  {
+    writer->SetFileName(tmpFile.string().c_str());
+    success = writer->Write() != 0;
+  }
 
-  vtksysMD5* md5 = vtksysMD5_New();
-  vtksysMD5_Initialize(md5);
-  vtksysMD5_Append(
-    md5, reinterpret_cast<const unsigned char*>(buffer.data()), static_cast<int>(length));
-  vtksysMD5_Finalize(md5, digest);
-  vtksysMD5_DigestToHex(digest, md5Hash);
-  vtksysMD5_Delete(md5);
+  std::vector<fs::path> dataPaths;
+  for (const fs::directory_entry& entry : fs::directory_iterator(tmpDirectory, ec))
+  {
+    if (entry.path() != tmpFile)
+    {
+      dataPaths.emplace_back(entry.path());
+    }
+  }
+  for (const fs::path& dataPath : dataPaths)
+  {
+    if (success)
+    {
+      fs::rename(dataPath, target.parent_path() / dataPath.filename(), ec);
+      success = !ec;
+    }
+  }
+  if (success)
+  {
+    fs::rename(tmpFile, target, ec);
+    success = !ec;
+  }
+  fs::remove_all(tmpDirectory, ec);
 
-  return md5Hash;
+  // Another writer may have written the same cache file first
+  if (!success && !fs::exists(target, ec))
+  {
+    F3DLog::Print(F3DLog::Severity::Warning, "Could not write cache file " + path);
+  }
+  return success;
 }
 
 //----------------------------------------------------------------------------
@@ -180,44 +211,72 @@ vtkSmartPointer<vtkImageData> SaveTextureToImage(
 }
 
 //----------------------------------------------------------------------------
-// TODO : add this function in a utils file for rendering in VTK directly
-vtkSmartPointer<vtkTexture> GetTexture(const fs::path& filePath, bool isSRGB = false)
+// TODO : add this class in a utils file for rendering in VTK directly
+/**
+ * A texture file submitted to the decode pool on construction,
+ * only waited for when the texture is first requested with Get.
+ */
+class PendingTexture
 {
-  vtkSmartPointer<vtkTexture> texture;
-  std::string fullPath = ::DeprecatedCollapsePath(filePath);
-  if (!fullPath.empty())
+public:
+  PendingTexture(const std::optional<fs::path>& filePath, bool isSRGB = false)
+    : IsSRGB(isSRGB)
   {
-    if (!vtksys::SystemTools::FileExists(fullPath))
+    if (filePath.has_value())
     {
-      F3DLog::Print(F3DLog::Severity::Warning, "Texture file does not exist " + fullPath);
+      this->FullPath = ::DeprecatedCollapsePath(filePath.value());
     }
-    else
+    if (!this->FullPath.empty())
     {
-      auto reader = vtkSmartPointer<vtkImageReader2>::Take(
-        vtkImageReader2Factory::CreateImageReader2(fullPath.c_str()));
-      if (reader)
+      if (!vtksys::SystemTools::FileExists(this->FullPath))
       {
-        reader->SetFileName(fullPath.c_str());
-        reader->Update();
-        texture = vtkSmartPointer<vtkTexture>::New();
-        texture->SetInputConnection(reader->GetOutputPort());
-        if (isSRGB)
-        {
-          texture->UseSRGBColorSpaceOn();
-        }
-        texture->InterpolateOn();
-        texture->SetColorModeToDirectScalars();
-        return texture;
+        F3DLog::Print(F3DLog::Severity::Warning, "Texture file does not exist " + this->FullPath);
       }
       else
       {
-        F3DLog::Print(F3DLog::Severity::Warning, "Cannot open texture file " + fullPath);
+        // decoded images are shared between all actors and calls using the same file
+        this->Image = F3DTextureDecoder::DecodeFile(this->FullPath);
       }
     }
   }
 
-  return texture;
-}
+  /**
+   * Wait for the decoded image and return the texture using it,
+   * nullptr if there is no texture or if it cannot be decoded
+   */
+  vtkTexture* Get()
+  {
+    if (!this->Image.valid())
+    {
+      return this->Texture;
+    }
+
+    vtkSmartPointer<vtkImageData> image = this->Image.get();
+    this->Image = {};
+    if (image)
+    {
+      this->Texture = vtkSmartPointer<vtkTexture>::New();
+      this->Texture->SetInputData(image);
+      if (this->IsSRGB)
+      {
+        this->Texture->UseSRGBColorSpaceOn();
+      }
+      this->Texture->InterpolateOn();
+      this->Texture->SetColorModeToDirectScalars();
+    }
+    else
+    {
+      F3DLog::Print(F3DLog::Severity::Warning, "Cannot open texture file " + this->FullPath);
+    }
+    return this->Texture;
+  }
+
+private:
+  std::string FullPath;
+  bool IsSRGB;
+  F3DTextureDecoder::Image Image;
+  vtkSmartPointer<vtkTexture> Texture;
+};
 
 template<typename F>
 void ExecFuncOnAllPolyDataUniforms(vtkActorCollection* actors, F&& func)
@@ -270,11 +329,7 @@ vtkF3DRenderer::~vtkF3DRenderer() = default;
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ReleaseGraphicsResources(vtkWindow* w)
 {
-  if (this->Timer != 0)
-  {
-    glDeleteQueries(1, &this->Timer);
-    this->Timer = 0;
-  }
+  this->GPUTimer->ReleaseGraphicsResources();
 
   this->UIActor->ReleaseGraphicsResources(w);
 
@@ -286,6 +341,7 @@ void vtkF3DRenderer::Initialize()
 {
   this->OriginalLightIntensities.clear();
   this->RemoveAllViewProps();
+  this->FrustumCuller->ClearCache();
   this->RemoveAllLights();
 
   this->ImporterTimeStamp = 0;
@@ -1116,6 +1172,12 @@ void vtkF3DRenderer::SetHDRIFile(const std::optional<fs::path>& hdriFile)
   {
     this->HDRIFile = hdriFileStr;
 
+    // A preparation of the previous HDRI cannot be cancelled, let it finish in the background
+    if (this->HDRIPreparation.valid())
+    {
+      this->DiscardedHDRIPreparations.emplace_back(std::move(this->HDRIPreparation));
+    }
+
     this->TextActorsConfigured = false;
     this->RenderPassesConfigured = false;
 
@@ -1177,6 +1239,25 @@ void vtkF3DRenderer::SetCachePath(const std::string& cachePath)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::SetHDRIAsyncPreparation(bool async)
+{
+  this->HDRIAsyncPreparation = async;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DRenderer::GetHDRIAsyncPreparation() const
+{
+  return this->HDRIAsyncPreparation;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DRenderer::IsHDRIPreparationReady()
+{
+  return this->HDRIPreparation.valid() &&
+    this->HDRIPreparation.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
 //----------------------------------------------------------------------------
 bool vtkF3DRenderer::CheckForSHCache(std::string& path)
 {
@@ -1196,6 +1277,20 @@ bool vtkF3DRenderer::CheckForSpecCache(std::string& path)
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ConfigureHDRI()
 {
+  // Swap in the HDRI prepared in the background once ready,
+  // or right away if the renderer should not wait for it anymore
+  if (this->HDRIPreparation.valid() &&
+    (!this->HDRIAsyncPreparation || this->IsHDRIPreparationReady()))
+  {
+    this->FinishHDRIPreparation();
+  }
+
+  this->DiscardedHDRIPreparations.erase(
+    std::remove_if(this->DiscardedHDRIPreparations.begin(), this->DiscardedHDRIPreparations.end(),
+      [](const std::future<HDRIPreparationResult>& preparation)
+      { return preparation.wait_for(std::chrono::seconds(0)) == std::future_status::ready; }),
+    this->DiscardedHDRIPreparations.end());
+
   if (!this->HDRIReaderConfigured)
   {
     this->ConfigureHDRIReader();
@@ -1255,6 +1350,15 @@ void vtkF3DRenderer::ConfigureHDRIReader()
           this->HDRIReader->SetFileName(this->HDRIFile.c_str());
           std::filesystem::path hdriPath(this->HDRIFile);
           this->UIActor->SetHDRIFileName(hdriPath.filename().string().c_str());
+
+          if (this->HDRIAsyncPreparation)
+          {
+            // Prepare the HDRI in the background, the default HDRI is used until it is ready
+            this->HDRIPreparation = std::async(std::launch::async, &vtkF3DRenderer::PrepareHDRI,
+              this->HDRIReader, this->HDRIFile, this->CachePath, this->GetUseImageBasedLighting(),
+              this->HDRISkyboxVisible || this->UseRaytracing);
+            this->HDRIReader = nullptr;
+          }
         }
         else
         {
@@ -1286,6 +1390,107 @@ void vtkF3DRenderer::ConfigureHDRIReader()
   this->HDRIReaderConfigured = true;
 }
 
+//----------------------------------------------------------------------------
+vtkF3DRenderer::HDRIPreparationResult vtkF3DRenderer::PrepareHDRI(vtkImageReader2* reader,
+  const std::string& hdriFile, const std::string& cachePath, bool useImageBasedLighting,
+  bool needImage)
+{
+  HDRIPreparationResult result;
+  result.Reader = reader;
+
+  std::string shCachePath;
+  if (useImageBasedLighting)
+  {
+    result.Hash = F3DFileHash::Get(hdriFile, cachePath);
+
+    if (!cachePath.empty())
+    {
+      const std::string hashCachePath = cachePath + "/" + result.Hash;
+      vtksys::SystemTools::MakeDirectory(hashCachePath);
+
+      // Without a cached specular texture, the image is needed to compute it
+      needImage =
+        needImage || !vtksys::SystemTools::FileExists(hashCachePath + "/specular.vtm", true);
+
+      shCachePath = hashCachePath + "/sh.vtt";
+      if (vtksys::SystemTools::FileExists(shCachePath, true))
+      {
+        vtkNew<vtkXMLTableReader> shReader;
+        shReader->SetFileName(shCachePath.c_str());
+        shReader->Update();
+        result.SphericalHarmonics =
+          vtkFloatArray::SafeDownCast(shReader->GetOutput()->GetColumn(0));
+      }
+    }
+  }
+
+  if (needImage || (useImageBasedLighting && !result.SphericalHarmonics))
+  {
+    reader->Update();
+  }
+
+  if (useImageBasedLighting && !result.SphericalHarmonics)
+  {
+    vtkNew<vtkSphericalHarmonics> sh;
+    sh->SetInputData(reader->GetOutput());
+    sh->Update();
+    result.SphericalHarmonics = vtkFloatArray::SafeDownCast(
+      vtkTable::SafeDownCast(sh->GetOutputDataObject(0))->GetColumn(0));
+
+    if (!shCachePath.empty())
+    {
+      // Create spherical harmonics cache file
+      vtkNew<vtkTable> table;
+      table->AddColumn(result.SphericalHarmonics);
+
+      vtkNew<vtkXMLTableWriter> writer;
+      writer->SetInputData(table);
+      ::WriteCacheFile(writer, shCachePath);
+    }
+  }
+
+  return result;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::FinishHDRIPreparation()
+{
+  HDRIPreparationResult result = this->HDRIPreparation.get();
+
+  this->HDRIReader = result.Reader;
+  this->UseDefaultHDRI = false;
+  this->HasValidHDRIReader = true;
+  this->HDRIReaderConfigured = true;
+
+  // The hash is only computed when using image based lighting
+  this->HasValidHDRIHash = !result.Hash.empty();
+  this->HDRIHashConfigured = this->HasValidHDRIHash;
+  if (this->HasValidHDRIHash)
+  {
+    this->HDRIHash = result.Hash;
+    this->CreateCacheDirectory();
+  }
+
+  this->HasValidHDRISH = result.SphericalHarmonics != nullptr;
+  if (this->HasValidHDRISH)
+  {
+    this->SphericalHarmonics = result.SphericalHarmonics;
+    if (this->CachePath.empty())
+    {
+      F3DLog::Print(F3DLog::Severity::Warning,
+        "Cannot cache HDRI Spherical Harmonics as no cache path has been set.");
+    }
+  }
+
+  // Everything else depends on the HDRI texture
+  this->HasValidHDRITexture = false;
+  this->HasValidHDRISpec = false;
+  this->HDRITextureConfigured = false;
+  this->HDRISphericalHarmonicsConfigured = false;
+  this->HDRISpecularConfigured = false;
+  this->HDRISkyboxConfigured = false;
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ConfigureHDRIHash()
 {
@@ -1297,8 +1502,8 @@ void vtkF3DRenderer::ConfigureHDRIHash()
     }
     else
     {
-      // Compute HDRI MD5, here we know the HDRIFile is not empty
-      this->HDRIHash = ::ComputeFileHash(this->HDRIFile);
+      // Get HDRI MD5, here we know the HDRIFile is not empty
+      this->HDRIHash = F3DFileHash::Get(this->HDRIFile, this->CachePath);
     }
     this->HasValidHDRIHash = true;
     this->CreateCacheDirectory();
@@ -1410,9 +1615,8 @@ void vtkF3DRenderer::ConfigureHDRILUT()
         assert(img);
 
         vtkNew<vtkXMLImageDataWriter> writer;
-        writer->SetFileName(lutCachePath.c_str());
         writer->SetInputData(img);
-        writer->Write();
+        ::WriteCacheFile(writer, lutCachePath);
       }
       else
       {
@@ -1461,8 +1665,7 @@ void vtkF3DRenderer::ConfigureHDRISphericalHarmonics()
 
         vtkNew<vtkXMLTableWriter> writer;
         writer->SetInputData(table);
-        writer->SetFileName(shCachePath.c_str());
-        writer->Write();
+        ::WriteCacheFile(writer, shCachePath);
       }
       else
       {
@@ -1522,9 +1725,8 @@ void vtkF3DRenderer::ConfigureHDRISpecular()
         writer->SetDataModeToAppended();
         writer->EncodeAppendedDataOff();
         writer->SetHeaderTypeToUInt64();
-        writer->SetFileName(specCachePath.c_str());
         writer->SetInputData(mb);
-        writer->Write();
+        ::WriteCacheFile(writer, specCachePath);
       }
       else
       {
@@ -1730,6 +1932,29 @@ void vtkF3DRenderer::SetUseSSAOPass(bool use)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::SetUseCulling(bool use)
+{
+  if (this->UseCulling != use)
+  {
+    this->UseCulling = use;
+    if (use)
+    {
+      this->AddCuller(this->FrustumCuller);
+    }
+    else
+    {
+      this->RemoveCuller(this->FrustumCuller);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::SetCullingMinimumInteractionSize(double size)
+{
+  this->FrustumCuller->SetMinimumInteractionSize(size);
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::SetFinalShader(const std::optional<std::string>& finalShader)
 {
@@ -1825,6 +2050,12 @@ void vtkF3DRenderer::ShowTimer(bool show)
   }
 }
 
+//----------------------------------------------------------------------------
+vtkF3DGPUTimer* vtkF3DRenderer::GetGPUTimer()
+{
+  return this->GPUTimer;
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ShowFilename(bool show)
 {
@@ -2113,47 +2344,39 @@ void vtkF3DRenderer::UpdateActors()
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::Render()
 {
-  if (!this->TimerVisible)
+  vtkInformation* info = this->GetInformation();
+  bool uiOnly = info->Get(vtkF3DRenderPass::RENDER_UI_ONLY());
+
+  // UI only renders are not measured
+  if ((!this->TimerVisible && !this->TimingsEnabled) || uiOnly)
   {
     this->Superclass::Render();
     return;
   }
 
   auto cpuStart = std::chrono::high_resolution_clock::now();
-  if (this->Timer == 0)
-  {
-    glGenQueries(1, &this->Timer);
-  }
-
-#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
-  glBeginQuery(GL_TIME_ELAPSED, this->Timer);
-#endif
 
+  this->GPUTimer->StartFrame();
   this->Superclass::Render();
+  this->GPUTimer->StopFrame();
 
   auto cpuElapsed = std::chrono::high_resolution_clock::now() - cpuStart;
 
-  vtkInformation* info = this->GetInformation();
+  // Get CPU frame time
+  double elapsedTime =
+    std::chrono::duration_cast<std::chrono::microseconds>(cpuElapsed).count() * 1e-6;
 
-  bool uiOnly = info->Get(vtkF3DRenderPass::RENDER_UI_ONLY());
-
-  if (!uiOnly)
+  // GPU timings are read back a few frames later to never wait for the GPU,
+  // so they are the timings of the last frame whose results are available
+  const std::vector<std::pair<std::string, double>>& timings = this->GPUTimer->GetTimings();
+  if (!timings.empty())
   {
-    // Get CPU frame time
-    double elapsedTime =
-      std::chrono::duration_cast<std::chrono::microseconds>(cpuElapsed).count() * 1e-6;
-
-#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
-    glEndQuery(GL_TIME_ELAPSED);
-    GLint elapsed;
-    glGetQueryObjectiv(this->Timer, GL_QUERY_RESULT, &elapsed);
-
     // Get min between CPU frame time and GPU frame time
-    elapsedTime = std::min(elapsedTime, elapsed * 1e-9);
-#endif
-
-    this->UIActor->UpdateFpsValue(elapsedTime);
+    elapsedTime = std::min(elapsedTime, timings.front().second);
   }
+
+  this->UIActor->UpdateFpsValue(elapsedTime);
+  this->UIActor->SetRenderTimings(timings);
 }
 
 //----------------------------------------------------------------------------
@@ -2440,6 +2663,13 @@ void vtkF3DRenderer::ConfigureActorsProperties()
     }
   }
 
+  // Textures are decoded in parallel and only waited for when bound to the first actor
+  ::PendingTexture colorTex(this->TextureBaseColor, true);
+  ::PendingTexture matTex(this->TextureMaterial);
+  ::PendingTexture emissTex(this->TextureEmissive, true);
+  ::PendingTexture normTex(this->TextureNormal);
+  ::PendingTexture matCapTex(this->TextureMatCap);
+
   for (const auto& coloring : this->Importer->GetColoringActorsAndMappers())
   {
     if (this->EdgeVisible.has_value())
@@ -2517,12 +2747,12 @@ void vtkF3DRenderer::ConfigureActorsProperties()
 
     if (this->TextureBaseColor.has_value())
     {
-      auto colorTex = ::GetTexture(this->TextureBaseColor.value(), true);
-      coloring.Actor->GetProperty()->SetBaseColorTexture(colorTex);
-      coloring.OriginalActor->GetProperty()->SetBaseColorTexture(colorTex);
+      vtkTexture* tex = colorTex.Get();
+      coloring.Actor->GetProperty()->SetBaseColorTexture(tex);
+      coloring.OriginalActor->GetProperty()->SetBaseColorTexture(tex);
 
       // If the input texture is RGBA, flag the coloring.Actor as translucent
-      if (colorTex && colorTex->GetImageDataInput(0)->GetNumberOfScalarComponents() == 4)
+      if (tex && tex->GetImageDataInput(0)->GetNumberOfScalarComponents() == 4)
       {
         coloring.Actor->ForceTranslucentOn();
         coloring.OriginalActor->ForceTranslucentOn();
@@ -2531,16 +2761,16 @@ void vtkF3DRenderer::ConfigureActorsProperties()
 
     if (this->TextureMaterial.has_value())
     {
-      auto matTex = ::GetTexture(this->TextureMaterial.value());
-      coloring.Actor->GetProperty()->SetORMTexture(matTex);
-      coloring.OriginalActor->GetProperty()->SetORMTexture(matTex);
+      vtkTexture* tex = matTex.Get();
+      coloring.Actor->GetProperty()->SetORMTexture(tex);
+      coloring.OriginalActor->GetProperty()->SetORMTexture(tex);
     }
 
     if (this->TextureEmissive.has_value())
     {
-      auto emissTex = ::GetTexture(this->TextureEmissive.value(), true);
-      coloring.Actor->GetProperty()->SetEmissiveTexture(emissTex);
-      coloring.OriginalActor->GetProperty()->SetEmissiveTexture(emissTex);
+      vtkTexture* tex = emissTex.Get();
+      coloring.Actor->GetProperty()->SetEmissiveTexture(tex);
+      coloring.OriginalActor->GetProperty()->SetEmissiveTexture(tex);
     }
 
     if (emissiveFactor)
@@ -2551,9 +2781,9 @@ void vtkF3DRenderer::ConfigureActorsProperties()
 
     if (this->TextureNormal.has_value())
     {
-      auto normTex = ::GetTexture(this->TextureNormal.value());
-      coloring.Actor->GetProperty()->SetNormalTexture(normTex);
-      coloring.OriginalActor->GetProperty()->SetNormalTexture(normTex);
+      vtkTexture* tex = normTex.Get();
+      coloring.Actor->GetProperty()->SetNormalTexture(tex);
+      coloring.OriginalActor->GetProperty()->SetNormalTexture(tex);
     }
 
     if (this->NormalScale.has_value())
@@ -2564,9 +2794,9 @@ void vtkF3DRenderer::ConfigureActorsProperties()
 
     if (this->TextureMatCap.has_value())
     {
-      auto matCapTex = ::GetTexture(this->TextureMatCap.value());
-      coloring.Actor->GetProperty()->SetTexture("matcap", matCapTex);
-      coloring.OriginalActor->GetProperty()->SetTexture("matcap", matCapTex);
+      vtkTexture* tex = matCapTex.Get();
+      coloring.Actor->GetProperty()->SetTexture("matcap", tex);
+      coloring.OriginalActor->GetProperty()->SetTexture("matcap", tex);
     }
   }
 
@@ -2891,6 +3121,12 @@ void vtkF3DRenderer::ConfigureColoring()
   F3DColoringInfoHandler& coloringHandler = this->Importer->GetColoringInfoHandler();
   auto info = coloringHandler.SetCurrentColoring(
     enableColoring, this->UseCellColoring, this->ArrayNameForColoring, false);
+  if (info.has_value() &&
+    this->Importer->LoadColoringArray(info.value().Name, this->UseCellColoring))
+  {
+    // The array has just been read on demand, recover its actual info
+    info = this->Importer->GetColoringInfoHandler().GetCurrentColoringInfo();
+  }
   bool hasColoring = info.has_value();
   if (hasColoring && !this->ColorTransferFunctionConfigured)
   {
@@ -3353,6 +3589,12 @@ void vtkF3DRenderer::CycleArrayForColoring()
   this->Importer->GetColoringInfoHandler().CycleColoringArray(
     !this->UseVolume); // TODO check this cond
   auto info = this->Importer->GetColoringInfoHandler().GetCurrentColoringInfo();
+  if (info.has_value() &&
+    this->Importer->LoadColoringArray(info.value().Name, this->UseCellColoring))
+  {
+    // The array has just been read on demand, recover its number of components
+    info = this->Importer->GetColoringInfoHandler().GetCurrentColoringInfo();
+  }
   bool enable = info.has_value();
 
   this->SetEnableColoring(enable);
@@ -13,6 +13,8 @@
 
 #include "F3DStyle.h"
 
+#include "vtkF3DFrustumCuller.h"
+#include "vtkF3DGPUTimer.h"
 #include "vtkF3DMetaImporter.h"
 #include "vtkF3DUIActor.h"
 
@@ -23,8 +25,10 @@
 
 #include <array>
 #include <filesystem>
+#include <future>
 #include <map>
 #include <optional>
+#include <vector>
 
 namespace fs = std::filesystem;
 
@@ -34,6 +38,7 @@ class vtkColorTransferFunction;
 class vtkCornerAnnotation;
 class vtkDiscretizableColorTransferFunction;
 class vtkF3DOpenGLGridMapper;
+class vtkFloatArray;
 class vtkGridAxesActor3D;
 class vtkImageReader2;
 class vtkOrientationMarkerWidget;
@@ -149,6 +154,17 @@ public:
   void SetFinalShader(const std::optional<std::string>& finalShader);
   ///@}
 
+  /**
+   * Set the usage of frustum culling, which skips the props outside of the view frustum
+   */
+  void SetUseCulling(bool use);
+
+  /**
+   * Set the minimum size in pixels on screen of the props rendered while interacting
+   * when using frustum culling, 0 to disable
+   */
+  void SetCullingMinimumInteractionSize(double size);
+
   /**
    * Get BlendingMode
    */
@@ -175,6 +191,21 @@ public:
   vtkGetMacro(InvertZoom, bool);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get whether frames are measured by the GPU timer even when the timer is not visible
+   * False by default
+   */
+  vtkSetMacro(TimingsEnabled, bool);
+  vtkGetMacro(TimingsEnabled, bool);
+  ///@}
+
+  /**
+   * Get the timer measuring the GPU time of frames and of render passes
+   * Frames are measured only when the timer is visible or when timings are enabled
+   */
+  vtkF3DGPUTimer* GetGPUTimer();
+
   /**
    * Reimplemented to configure:
    *  - ActorsProperties
@@ -248,6 +279,24 @@ public:
    */
   void SetCachePath(const std::string& cachePath);
 
+  ///@{
+  /**
+   * Set/Get if HDRI files are prepared in the background.
+   * When enabled, a new HDRI file is read and its spherical harmonics are computed in a
+   * background thread while the default HDRI is displayed. The HDRI is then swapped in
+   * during the first render after it is ready, see IsHDRIPreparationReady.
+   * When disabled, a pending preparation is waited for during the next render.
+   * Default is false.
+   */
+  void SetHDRIAsyncPreparation(bool async);
+  bool GetHDRIAsyncPreparation() const;
+  ///@}
+
+  /**
+   * Return true if an HDRI prepared in the background is ready to be swapped in by a render.
+   */
+  bool IsHDRIPreparationReady();
+
   /**
    * Set the roughness on all actors
    */
@@ -521,6 +570,29 @@ private:
   void ConfigureHDRISkybox();
   ///@}
 
+  /**
+   * Result of an HDRI file prepared in the background
+   */
+  struct HDRIPreparationResult
+  {
+    vtkSmartPointer<vtkImageReader2> Reader;
+    std::string Hash;
+    vtkSmartPointer<vtkFloatArray> SphericalHarmonics;
+  };
+
+  /**
+   * Read an HDRI file and, when using image based lighting, get its hash and its spherical
+   * harmonics from the cache or by computing them.
+   * Does not use the renderer so that it can run in a background thread.
+   */
+  static HDRIPreparationResult PrepareHDRI(vtkImageReader2* reader, const std::string& hdriFile,
+    const std::string& cachePath, bool useImageBasedLighting, bool needImage);
+
+  /**
+   * Swap in the HDRI prepared in the background, waiting for it if needed
+   */
+  void FinishHDRIPreparation();
+
   ///@{
   /**
    * Methods to check if certain HDRI caches are available
@@ -636,7 +708,8 @@ private:
   vtkNew<vtkSkybox> SkyboxActor;
   vtkNew<vtkF3DUIActor> UIActor;
 
-  unsigned int Timer = 0; // Timer OpenGL query
+  vtkNew<vtkF3DGPUTimer> GPUTimer;
+  vtkNew<vtkF3DFrustumCuller> FrustumCuller;
 
   bool CheatSheetConfigured = false;
   bool ActorsPropertiesConfigured = false;
@@ -665,6 +738,7 @@ private:
 #endif
   std::optional<bool> EdgeVisible;
   bool TimerVisible = false;
+  bool TimingsEnabled = false;
   bool FilenameVisible = false;
   bool MetaDataVisible = false;
   bool HDRIFilenameVisible = false;
@@ -680,6 +754,7 @@ private:
   AntiAliasingMode AntiAliasingModeEnabled = AntiAliasingMode::NONE;
   BlendingMode BlendingModeEnabled = BlendingMode::NONE;
   bool UseSSAOPass = false;
+  bool UseCulling = false;
   bool UseToneMappingPass = false;
   bool DisplayDepth = false;
   bool DisplayDepthScalarColoring = false;
@@ -714,6 +789,9 @@ private:
   bool HasValidHDRILUT = false;
   bool HasValidHDRISH = false;
   bool HasValidHDRISpec = false;
+  bool HDRIAsyncPreparation = false;
+  std::future<HDRIPreparationResult> HDRIPreparation;
+  std::vector<std::future<HDRIPreparationResult>> DiscardedHDRIPreparations;
 
   std::optional<fs::path> FontFile;
   double FontScale = 1.0;
@@ -1,5 +1,7 @@
 #include "vtkF3DTAAPass.h"
 
+#include "vtkF3DGPUTimer.h"
+
 #include <vtkCamera.h>
 #include <vtkObjectFactory.h>
 #include <vtkOpenGLError.h>
@@ -83,6 +85,8 @@ void vtkF3DTAAPass::Render(const vtkRenderState* state)
   renWin->GetState()->PopFramebufferBindings();
   this->PostRender(state);
 
+  vtkF3DGPUTimer::ScopedSection timerSection(renderer, "TAA");
+
   if (!this->QuadHelper)
   {
     std::string TAAResolveFS = vtkOpenGLRenderUtilities::GetFullScreenQuadFragmentShaderTemplate();
@@ -127,6 +127,12 @@ void vtkF3DUIActor::UpdateFpsValue(const double elapsedFrameTime)
   this->FpsValue = static_cast<int>(std::round(1.0 / averageFrameTime));
 }
 
+//----------------------------------------------------------------------------
+void vtkF3DUIActor::SetRenderTimings(const std::vector<std::pair<std::string, double>>& timings)
+{
+  this->RenderTimings = timings;
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DUIActor::SetFontFile(const std::string& font)
 {
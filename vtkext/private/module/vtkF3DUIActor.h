@@ -147,6 +147,12 @@ public:
    */
   void UpdateFpsValue(const double elapsedFrameTime);
 
+  /**
+   * Set the render timings in seconds displayed below the fps value
+   * Empty by default
+   */
+  void SetRenderTimings(const std::vector<std::pair<std::string, double>>& timings);
+
   /**
    * Set the font file path
    * Use Inter font by default if empty
@@ -276,6 +282,7 @@ protected:
 
   double TotalFrameTimes = 0.0;
   int FpsValue = 0;
+  std::vector<std::pair<std::string, double>> RenderTimings;
 
   std::string FontFile = "";
   double FontScale = 1.0;
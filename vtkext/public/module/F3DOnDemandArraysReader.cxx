@@ -0,0 +1,4 @@
+#include "F3DOnDemandArraysReader.h"
+
+//----------------------------------------------------------------------------
+F3DOnDemandArraysReader::~F3DOnDemandArraysReader() = default;
@@ -0,0 +1,45 @@
+/**
+ * @class   F3DOnDemandArraysReader
+ * @brief   Interface for readers able to read their data arrays on demand
+ *
+ * Readers implementing this interface can read only the geometry and the array actually used,
+ * eg. for coloring, instead of all the arrays of a file at each time step.
+ * The generic importer lists the available arrays so they can be selected for coloring
+ * and asks the reader to read an array when it is selected.
+ */
+
+#ifndef F3DOnDemandArraysReader_h
+#define F3DOnDemandArraysReader_h
+
+#include "vtkextModule.h"
+
+/// @cond
+#include <string>
+#include <vector>
+/// @endcond
+
+class VTKEXT_EXPORT F3DOnDemandArraysReader
+{
+public:
+  virtual ~F3DOnDemandArraysReader();
+
+  /**
+   * Return true if arrays are only read once selected using SelectArray.
+   * When false, all arrays are read and other methods are not used.
+   */
+  virtual bool GetReadArraysOnDemand() = 0;
+
+  /**
+   * Get the names of the point or cell arrays that can be read.
+   */
+  virtual std::vector<std::string> GetAvailableArrays(bool cellData) = 0;
+
+  /**
+   * Select a point or cell array to read, in addition to the previously selected ones,
+   * so that switching between arrays does not read them again.
+   * Return true if the selection changed, in which case the reader needs to be updated.
+   */
+  virtual bool SelectArray(const std::string& name, bool cellData) = 0;
+};
+
+#endif
@@ -0,0 +1,350 @@
+#include "F3DTextureDecoder.h"
+
+#include <vtkImageReader2.h>
+#include <vtkImageReader2Factory.h>
+#include <vtkPointData.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+//----------------------------------------------------------------------------
+/**
+ * A pool of worker threads running decode tasks in submission order.
+ * Tasks are called with true when they are cancelled because the pool is stopped.
+ */
+class DecodePool
+{
+public:
+  using Task = std::function<void(bool)>;
+
+  DecodePool()
+  {
+    const unsigned int nbWorkers = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned int i = 0; i < nbWorkers; i++)
+    {
+      this->Workers.emplace_back(&DecodePool::Run, this);
+    }
+  }
+
+  ~DecodePool()
+  {
+    std::deque<Task> cancelled;
+    {
+      std::unique_lock<std::mutex> lock(this->Mutex);
+      this->Stopping = true;
+      cancelled.swap(this->Tasks);
+    }
+    this->Condition.notify_all();
+    for (std::thread& worker : this->Workers)
+    {
+      worker.join();
+    }
+    for (Task& task : cancelled)
+    {
+      task(true);
+    }
+  }
+
+  void Push(Task task)
+  {
+    {
+      std::unique_lock<std::mutex> lock(this->Mutex);
+      this->Tasks.emplace_back(std::move(task));
+    }
+    this->Condition.notify_one();
+  }
+
+private:
+  void Run()
+  {
+    while (true)
+    {
+      Task task;
+      {
+        std::unique_lock<std::mutex> lock(this->Mutex);
+        this->Condition.wait(lock, [this]() { return this->Stopping || !this->Tasks.empty(); });
+        if (this->Stopping)
+        {
+          return;
+        }
+        task = std::move(this->Tasks.front());
+        this->Tasks.pop_front();
+      }
+      task(false);
+    }
+  }
+
+  std::mutex Mutex;
+  std::condition_variable Condition;
+  std::deque<Task> Tasks;
+  std::vector<std::thread> Workers;
+  bool Stopping = false;
+};
+
+//----------------------------------------------------------------------------
+/**
+ * The decode pool, alive between the first StartWorkers and the last StopWorkers calls.
+ * It is never destroyed by a static destructor, so its threads are never joined at exit
+ * or when unloading the library.
+ */
+struct DecodePoolHandle
+{
+  static DecodePoolHandle& Get()
+  {
+    static DecodePoolHandle* handle = new DecodePoolHandle();
+    return *handle;
+  }
+
+  std::mutex Mutex;
+  std::unique_ptr<DecodePool> Pool;
+  unsigned int References = 0;
+};
+
+//----------------------------------------------------------------------------
+/**
+ * Cache of decoded images, keyed by F3DTextureDecoder::GetCacheKey
+ */
+struct DecodeCache
+{
+  struct Entry
+  {
+    F3DTextureDecoder::Image Result;
+    uint64_t LastUse = 0;
+  };
+
+  static DecodeCache& Get()
+  {
+    static DecodeCache cache;
+    return cache;
+  }
+
+  /**
+   * Release least recently used decoded images until the cache fits the budget.
+   * Images still being decoded are never released.
+   * Must be called with Mutex locked.
+   */
+  void EnforceBudget()
+  {
+    std::vector<std::pair<uint64_t, std::string>> ready;
+    double size = 0;
+    for (const auto& [key, entry] : this->Entries)
+    {
+      if (entry.Result.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+      {
+        const vtkSmartPointer<vtkImageData>& image = entry.Result.get();
+        size += image ? static_cast<double>(image->GetActualMemorySize()) * 1024 : 0;
+        ready.emplace_back(entry.LastUse, key);
+      }
+    }
+
+    std::sort(ready.begin(), ready.end());
+    for (auto it = ready.begin(); it != ready.end() && size > this->Budget; ++it)
+    {
+      const vtkSmartPointer<vtkImageData>& image = this->Entries[it->second].Result.get();
+      size -= image ? static_cast<double>(image->GetActualMemorySize()) * 1024 : 0;
+      this->Entries.erase(it->second);
+    }
+  }
+
+  std::mutex Mutex;
+  std::unordered_map<std::string, Entry> Entries;
+  uint64_t UseCounter = 0;
+  double Budget = 1024.0 * 1024 * 1024;
+};
+
+//----------------------------------------------------------------------------
+using ImagePromise = std::promise<vtkSmartPointer<vtkImageData>>;
+
+//----------------------------------------------------------------------------
+F3DTextureDecoder::Image MakeReadyImage(vtkSmartPointer<vtkImageData> image)
+{
+  std::promise<vtkSmartPointer<vtkImageData>> promise;
+  promise.set_value(image);
+  return promise.get_future().share();
+}
+
+//----------------------------------------------------------------------------
+/**
+ * Decode using the reader on the decode pool, or right away without workers,
+ * and set the decoded image, or nullptr, as the value of the promise
+ */
+void Submit(vtkImageReader2* reader, std::shared_ptr<ImagePromise> promise)
+{
+  vtkSmartPointer<vtkImageReader2> readerPtr = reader;
+  DecodePool::Task task = [promise, readerPtr](bool cancelled)
+  {
+    vtkImageData* output = nullptr;
+    if (!cancelled)
+    {
+      readerPtr->Update();
+      output = readerPtr->GetOutput();
+    }
+    if (!output || !output->GetPointData()->GetScalars())
+    {
+      promise->set_value(nullptr);
+      return;
+    }
+
+    // shallow copy so the reader and its pipeline can be released
+    auto image = vtkSmartPointer<vtkImageData>::New();
+    image->ShallowCopy(output);
+    promise->set_value(image);
+  };
+
+  DecodePoolHandle& handle = DecodePoolHandle::Get();
+  std::unique_lock<std::mutex> lock(handle.Mutex);
+  if (handle.Pool)
+  {
+    handle.Pool->Push(std::move(task));
+    return;
+  }
+  lock.unlock();
+  task(false);
+}
+
+//----------------------------------------------------------------------------
+template<typename F>
+F3DTextureDecoder::Image FindOrSubmit(const std::string& key, F&& createReader)
+{
+  DecodeCache& cache = DecodeCache::Get();
+  auto promise = std::make_shared<ImagePromise>();
+  F3DTextureDecoder::Image result;
+  {
+    std::unique_lock<std::mutex> lock(cache.Mutex);
+    auto it = cache.Entries.find(key);
+    if (it != cache.Entries.end())
+    {
+      it->second.LastUse = ++cache.UseCounter;
+      return it->second.Result;
+    }
+
+    // Other requests for the same key wait for this one
+    DecodeCache::Entry& entry = cache.Entries[key];
+    entry.Result = promise->get_future().share();
+    entry.LastUse = ++cache.UseCounter;
+    result = entry.Result;
+    cache.EnforceBudget();
+  }
+
+  // Creating a reader may read the file, it is done without holding the cache lock
+  vtkSmartPointer<vtkImageReader2> reader = createReader();
+  if (!reader)
+  {
+    promise->set_value(nullptr);
+    return result;
+  }
+
+  ::Submit(reader, promise);
+  return result;
+}
+}
+
+//----------------------------------------------------------------------------
+F3DTextureDecoder::Image F3DTextureDecoder::DecodeFile(const std::string& path)
+{
+  return ::FindOrSubmit(F3DTextureDecoder::GetCacheKey(path),
+    [&]()
+    {
+      vtkSmartPointer<vtkImageReader2> reader;
+      reader.TakeReference(vtkImageReader2Factory::CreateImageReader2(path.c_str()));
+      if (reader)
+      {
+        reader->SetFileName(path.c_str());
+      }
+      return reader;
+    });
+}
+
+//----------------------------------------------------------------------------
+F3DTextureDecoder::Image F3DTextureDecoder::DecodeReader(
+  vtkImageReader2* reader, const std::string& key)
+{
+  if (!reader)
+  {
+    return ::MakeReadyImage(nullptr);
+  }
+
+  if (key.empty())
+  {
+    auto promise = std::make_shared<ImagePromise>();
+    F3DTextureDecoder::Image result = promise->get_future().share();
+    ::Submit(reader, promise);
+    return result;
+  }
+
+  return ::FindOrSubmit(key, [&]() { return vtkSmartPointer<vtkImageReader2>(reader); });
+}
+
+//----------------------------------------------------------------------------
+std::string F3DTextureDecoder::GetCacheKey(const std::string& path)
+{
+  std::error_code ec;
+  const auto time = fs::last_write_time(fs::path(path), ec);
+  if (ec)
+  {
+    return path;
+  }
+  return path + "|" + std::to_string(time.time_since_epoch().count());
+}
+
+//----------------------------------------------------------------------------
+void F3DTextureDecoder::SetCacheBudget(double budget)
+{
+  DecodeCache& cache = DecodeCache::Get();
+  std::unique_lock<std::mutex> lock(cache.Mutex);
+  cache.Budget = std::max(0.0, budget) * 1024 * 1024;
+  cache.EnforceBudget();
+}
+
+//----------------------------------------------------------------------------
+void F3DTextureDecoder::ClearCache()
+{
+  DecodeCache& cache = DecodeCache::Get();
+  std::unique_lock<std::mutex> lock(cache.Mutex);
+  cache.Entries.clear();
+}
+
+//----------------------------------------------------------------------------
+void F3DTextureDecoder::StartWorkers()
+{
+  DecodePoolHandle& handle = DecodePoolHandle::Get();
+  std::unique_lock<std::mutex> lock(handle.Mutex);
+  if (handle.References++ == 0)
+  {
+    handle.Pool = std::make_unique<DecodePool>();
+  }
+}
+
+//----------------------------------------------------------------------------
+void F3DTextureDecoder::StopWorkers()
+{
+  std::unique_ptr<DecodePool> pool;
+  {
+    DecodePoolHandle& handle = DecodePoolHandle::Get();
+    std::unique_lock<std::mutex> lock(handle.Mutex);
+    if (handle.References == 0 || --handle.References > 0)
+    {
+      return;
+    }
+    pool = std::move(handle.Pool);
+  }
+
+  // Join the workers and cancel the queued decodes outside of the lock,
+  // then release the cancelled results
+  pool.reset();
+  F3DTextureDecoder::ClearCache();
+}
@@ -0,0 +1,77 @@
+/**
+ * @class   F3DTextureDecoder
+ * @brief   Namespace containing a process-wide image decode pool and cache
+ *
+ * Decode texture images on a pool of worker threads shared by the renderer and all importers.
+ * The pool lifetime is explicit, see StartWorkers, images are decoded by the calling thread
+ * when it is not started.
+ * Images read from files are cached by path and modification time so that importers or file
+ * groups referencing the same texture share a single decoded vtkImageData.
+ * The cache is bounded by a memory budget, least recently requested images are released first.
+ * Returned images are shared and must not be modified, use a shallow copy if needed.
+ */
+
+#ifndef F3DTextureDecoder_h
+#define F3DTextureDecoder_h
+
+#include "vtkextModule.h"
+
+/// @cond
+#include <vtkImageData.h>
+#include <vtkSmartPointer.h>
+
+#include <future>
+#include <string>
+/// @endcond
+
+class vtkImageReader2;
+
+namespace F3DTextureDecoder
+{
+using Image = std::shared_future<vtkSmartPointer<vtkImageData>>;
+
+/*
+ * Decode the image file at the provided path on the decode pool.
+ * Requests for the same unmodified file share the same decoded image.
+ * The result is a nullptr image if no reader supports the file or if the file cannot be read.
+ */
+VTKEXT_EXPORT Image DecodeFile(const std::string& path);
+
+/*
+ * Decode using an already configured reader, eg. reading from a memory buffer.
+ * The reader input must stay valid until the result is ready.
+ * When a non-empty key is provided, requests with the same key share the same decoded image.
+ * Use GetCacheKey to create a key depending on a file modification time.
+ */
+VTKEXT_EXPORT Image DecodeReader(vtkImageReader2* reader, const std::string& key = {});
+
+/*
+ * Create a cache key from a path and, if it exists, the modification time of the file.
+ */
+VTKEXT_EXPORT std::string GetCacheKey(const std::string& path);
+
+/*
+ * Set the memory budget of the cache in MiB, 1024 by default.
+ * Images still in use elsewhere are not freed by eviction, they just stop being shared.
+ */
+VTKEXT_EXPORT void SetCacheBudget(double budget);
+
+/*
+ * Release all cached images.
+ */
+VTKEXT_EXPORT void ClearCache();
+
+/*
+ * Start the decode worker threads, or add a reference to them if they are already started.
+ * Each call must be balanced by a call to StopWorkers.
+ */
+VTKEXT_EXPORT void StartWorkers();
+
+/*
+ * Remove a reference to the decode worker threads, and join them if it was the last one.
+ * Decodes still queued are cancelled, their result is a nullptr image, and the cache is cleared.
+ */
+VTKEXT_EXPORT void StopWorkers();
+}
+
+#endif
@@ -0,0 +1,69 @@
+#include <vtkImageData.h>
+
+#include "F3DTextureDecoder.h"
+
+#include <future>
+#include <iostream>
+
+int TestF3DTextureDecoder(int argc, char* argv[])
+{
+  std::string filename = std::string(argv[1]) + "data/albedo.png";
+
+  // Decode on the worker threads, images are decoded synchronously without them
+  F3DTextureDecoder::StartWorkers();
+
+  F3DTextureDecoder::Image first = F3DTextureDecoder::DecodeFile(filename);
+  F3DTextureDecoder::Image second = F3DTextureDecoder::DecodeFile(filename);
+
+  vtkImageData* img = first.get();
+  if (!img || img->GetNumberOfPoints() == 0)
+  {
+    std::cerr << "Texture was not decoded.\n";
+    return EXIT_FAILURE;
+  }
+
+  if (second.get() != img)
+  {
+    std::cerr << "Decoded texture is not shared.\n";
+    return EXIT_FAILURE;
+  }
+
+  if (F3DTextureDecoder::DecodeFile(std::string(argv[1]) + "data/nonExistentFile.png").get())
+  {
+    std::cerr << "Non existent texture should not be decoded.\n";
+    return EXIT_FAILURE;
+  }
+
+  // evicting the cache must not affect images already in use
+  F3DTextureDecoder::SetCacheBudget(0);
+  if (img->GetNumberOfPoints() == 0 || F3DTextureDecoder::DecodeFile(filename).get() == img)
+  {
+    std::cerr << "Texture cache budget is not respected.\n";
+    return EXIT_FAILURE;
+  }
+
+  // Stopping the workers cancels queued decodes without breaking their results
+  F3DTextureDecoder::ClearCache();
+  F3DTextureDecoder::Image queued = F3DTextureDecoder::DecodeFile(filename);
+  F3DTextureDecoder::StopWorkers();
+  try
+  {
+    queued.get();
+  }
+  catch (const std::future_error&)
+  {
+    std::cerr << "Queued decode result is broken after stopping the workers.\n";
+    return EXIT_FAILURE;
+  }
+
+  // Without workers, images are decoded right away
+  vtkImageData* syncImg = F3DTextureDecoder::DecodeFile(filename).get();
+  if (!syncImg || syncImg->GetNumberOfPoints() == 0)
+  {
+    std::cerr << "Texture was not decoded without workers.\n";
+    return EXIT_FAILURE;
+  }
+
+  F3DTextureDecoder::ClearCache();
+  return EXIT_SUCCESS;
+}